@@ -0,0 +1,502 @@
+/*!
+ * @file Audio.c
+ *
+ * Audio playback through the TCA0 PWM into the amplifier
+ *
+ * TCA0 makes the PWM carrier, at AUDIO_CARRIER_HZ which is well above hearing. The ATtiny1606 has no
+ * spare timer to pace the samples with, so the TCA0 low underflow interrupt does it at every PWM period:
+ * it adds the playing clip's step to a 16 bit phase, and each time the phase wraps it is time for the
+ * next sample. Every clip plays at its true pitch whatever the carrier is, each sample landing on the
+ * PWM period nearest its time, and a new duty cycle is loaded just after the counter wraps.
+ *
+ * Decoding a sample is kept out of the interrupt. The main loop decodes the playing clip ahead of time
+ * into a ring buffer with audio_fill(), and the interrupt only moves the next ready sample into the
+ * compare register. When the buffer drains down to AUDIO_RING_LOW_WATER the ISR posts
+ * EVENT_AUDIO_bm, which leaves the main loop that many sample periods to top it up again. ringHead is
+ * only written by the ISR and ringTail only by the main loop, so neither side needs to lock the other
+ * out while playing.
+ *
+ * Clips are described by clipTable, so the decoding only depends on a clip's format and never on
+ * which clip it is. When a one-shot clip's last sample has played the ISR posts EVENT_CLIP_DONE_bm.
+ *
+ * With AUDIO_SPI_FLASH defined the win and lose clips come from an external SPI flash instead of
+ * audioArrays.h. audio_play() looks them up in the flash image's directory, and audio_fill() streams
+ * their bytes in as it decodes, so they are only limited by the size of the flash part.
+ *
+ */
+
+#include "audio/audioArrays.h"
+#include "main.h"
+#include "Audio.h"
+#include "adpcm.h"
+#include "siren.h"
+#include "spiflash.h"
+#include "bench.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <stddef.h>
+
+/** Worst-case cycles for ISR(TCA0_LUNF_vect) including entry/exit, in a PWM period that loads a sample */
+#define AUDIO_ISR_MAX_CYCLES 80
+
+/** Most ISR(TCA0_LUNF_vect) runs in one sample period of the fastest clip */
+#define AUDIO_ISRS_PER_SAMPLE ((AUDIO_CARRIER_HZ + AUDIO_MAX_SAMPLE_RATE_HZ - 1) / AUDIO_MAX_SAMPLE_RATE_HZ)
+
+/** Worst-case cycles for audio_fill() to decode and queue one sample */
+#ifdef AUDIO_SPI_FLASH
+#define AUDIO_FILL_MAX_CYCLES (ADPCM_DECODE_MAX_CYCLES + SPIFLASH_BYTE_CYCLES + 40)
+#else
+#define AUDIO_FILL_MAX_CYCLES (ADPCM_DECODE_MAX_CYCLES + 40)
+#endif
+
+/** Slowest clip sample rate, below which the phase step rounds down to nothing */
+#define AUDIO_MIN_SAMPLE_RATE_HZ (AUDIO_CARRIER_HZ / 65536 + 1)
+
+#if (AUDIO_ISR_MAX_CYCLES >= AUDIO_PWM_PRESCALER * AUDIO_PWM_PERIOD)
+#error "ISR(TCA0_LUNF_vect) takes longer than a PWM period, shorten it or lengthen AUDIO_PWM_PERIOD"
+#endif
+
+#if (AUDIO_MAX_SAMPLE_RATE_HZ >= AUDIO_CARRIER_HZ)
+#error "Samples are loaded at most once per PWM period, lower AUDIO_MAX_SAMPLE_RATE_HZ below AUDIO_CARRIER_HZ"
+#endif
+
+#if (AUDIO_ISR_MAX_CYCLES * AUDIO_ISRS_PER_SAMPLE + AUDIO_FILL_MAX_CYCLES >= F_CPU / AUDIO_MAX_SAMPLE_RATE_HZ)
+#error "The main loop can't decode samples as fast as the fastest clip plays them, lower AUDIO_MAX_SAMPLE_RATE_HZ or shorten the decoder"
+#endif
+
+#if (AUDIO_CARRIER_HZ < 20000)
+#error "The PWM carrier would be audible, raise F_CPU or shorten AUDIO_PWM_PERIOD"
+#endif
+
+#if (YOUWIN_SAMPLE_RATE_HZ > AUDIO_MAX_SAMPLE_RATE_HZ) || (YOULOSE_SAMPLE_RATE_HZ > AUDIO_MAX_SAMPLE_RATE_HZ) || (SIREN_SAMPLE_RATE_HZ > AUDIO_MAX_SAMPLE_RATE_HZ)
+#error "A clip is faster than AUDIO_MAX_SAMPLE_RATE_HZ"
+#endif
+
+#if (YOUWIN_SAMPLE_RATE_HZ < AUDIO_MIN_SAMPLE_RATE_HZ) || (YOULOSE_SAMPLE_RATE_HZ < AUDIO_MIN_SAMPLE_RATE_HZ) || (SIREN_SAMPLE_RATE_HZ < AUDIO_MIN_SAMPLE_RATE_HZ)
+#error "A clip is too slow for the 16 bit sample phase"
+#endif
+
+#if (AUDIO_RING_LEN & AUDIO_RING_MASK) || (AUDIO_RING_LEN > 128)
+#error "AUDIO_RING_LEN must be a power of two that fits the 8 bit ring indexes"
+#endif
+
+/* clipIdx is 16 bits unless AUDIO_SPI_FLASH widens it, with no room to spare for 32 bit arithmetic */
+#if (YOUWIN_NUM_SAMPLES > 0xFFFF) || (YOULOSE_NUM_SAMPLES > 0xFFFF)
+#error "clipIdx is 16 bits, clips must be shorter than 65536 samples"
+#endif
+
+static uint8_t nextSample(void);
+#ifdef AUDIO_SPI_FLASH
+static const audio_clip_desc_t *openFlashClip(audio_clip_t clip);
+static void seekFlashClip(audio_idx_t idx);
+static uint8_t nextFlashSample(audio_idx_t idx);
+#endif
+
+/** Every clip audio_play() can play, indexed by audio_clip_t. Adding a clip only takes an entry here */
+static const audio_clip_desc_t clipTable[audio_clip_count] =
+{
+   [audio_clip_siren] = {NULL, 0, 0, SIREN_SAMPLE_RATE_HZ, AUDIO_FORMAT_SIREN},
+#ifdef AUDIO_SPI_FLASH
+   [audio_clip_win]   = {NULL, 0, 0, 0, AUDIO_FORMAT_SPI_FLASH},
+   [audio_clip_lose]  = {NULL, 0, 0, 0, AUDIO_FORMAT_SPI_FLASH},
+#else
+   [audio_clip_win]   = {youWin, YOUWIN_NUM_SAMPLES, YOUWIN_LOOP_START, YOUWIN_SAMPLE_RATE_HZ, YOUWIN_FORMAT},
+   [audio_clip_lose]  = {youLose, YOULOSE_NUM_SAMPLES, YOULOSE_LOOP_START, YOULOSE_SAMPLE_RATE_HZ, YOULOSE_FORMAT},
+#endif
+};
+
+static uint8_t ring[AUDIO_RING_LEN];  ///< Decoded samples waiting for the PWM
+static volatile uint8_t ringHead;  ///< Index of the next sample for the ISR to play, only written by the ISR while playing
+static volatile uint8_t ringTail;  ///< Index of the next free slot for audio_fill(), only written by the main loop
+static volatile uint16_t samplePhase;  ///< Fraction of a sample period gone by, the ISR loads a sample each time it wraps
+static volatile uint16_t sampleStep;  ///< What samplePhase advances by every PWM period, 65536 * sample rate / AUDIO_CARRIER_HZ
+static volatile bool clipQueued;  ///< The last sample of a one-shot clip is in the ring, the ISR posts EVENT_CLIP_DONE_bm once it plays
+static const audio_clip_desc_t *playingClip;  ///< Clip audio_fill() is decoding, NULL once stopped or a one-shot is fully queued
+static audio_mode_t playingMode;  ///< How playingClip was asked to play
+static audio_idx_t clipIdx;  ///< Index of the next sample of playingClip to decode
+static adpcm_state_t decoder;  ///< ADPCM decoder state for playingClip
+static adpcm_state_t loopDecoder;  ///< ADPCM decoder state at playingClip's loop point, restored on every loop
+static siren_state_t siren;  ///< Oscillator state for AUDIO_FORMAT_SIREN
+#ifdef AUDIO_SPI_FLASH
+static audio_clip_desc_t flashClip;  ///< Descriptor of the external clip being played, filled in from the flash image's directory
+static uint32_t flashClipAddr;  ///< Flash address of flashClip's first byte
+static uint8_t flashClipFormat;  ///< AUDIO_FORMAT_PCM8 or AUDIO_FORMAT_ADPCM4, how flashClip is stored
+static uint8_t flashByte;  ///< Last byte streamed in, which still holds the second ADPCM code of the pair
+#endif
+
+/*!
+ * @brief Setup the TCA0 timer and PWM output to the audio IC, audio_play() turns on its underflow interrupt to pace the samples.
+ *  Also setup the ~SHDN pin
+ *
+ * @param None
+ *
+ * @return None
+ */
+void audio_init(void)
+{
+   playingClip = NULL;
+   ringHead = 0;
+   ringTail = 0;
+   clipQueued = false;
+
+   /*
+    *	set Audio ~SHDN pin to output low for now
+    */
+   PORTB.DIRSET = PIN3_bm;
+   audio_enable(false);
+
+   /*
+    *	Setup PORTMUX to provide alternate WO1 output
+    */
+   PORTMUX.CTRLC = PORTMUX_TCA01_bm;
+
+   /*
+    *	setup PWM, at the full clock rate so the carrier is out of earshot
+    */
+   PORTB.DIRSET = PIN4_bm; // Set PWM pin to output
+   TCA0.SPLIT.CTRLD = TCA_SPLIT_SPLITM_bm; // Enable split mode based on v1.9.9 pinout
+   TCA0.SPLIT.CTRLB |= (TCA_SPLIT_LCMP1EN_bm); // LCMP1 corresponds to our WO1
+   TCA0.SPLIT.LPER  = AUDIO_PWM_PERIOD - 1; // use whole 8 bit array
+   TCA0.SPLIT.LCMP1 = 0; // this will be controlled by the audioArray
+   TCA0.SPLIT.CTRLA = (TCA_SPLIT_CLKSEL_DIV1_gc | TCA_SPLIT_ENABLE_bm);
+}
+
+/*!
+ * @brief Set or clear audio output SHDN pin based on provided bool arg.
+ *
+ * @param isEnabled
+ *   Set SHDN pin high if True, else set SHDN pin low
+ *
+ * @return None
+ */
+void audio_enable(bool isEnabled)
+{
+   if (isEnabled)
+   {
+      PORTB.OUTSET = PIN3_bm;
+   }
+   else
+   {
+      PORTB.OUTCLR = PIN3_bm;
+   }
+}
+
+/*!
+ * @brief Drop whatever is buffered and start 'clip' from its first sample
+ *
+ * @param clip
+ *  The clip to play
+ *
+ * @param mode
+ *  audio_mode_once to post EVENT_CLIP_DONE_bm at the end, audio_mode_loop to repeat it from its loop point
+ *
+ * @return None
+ */
+void audio_play(audio_clip_t clip, audio_mode_t mode)
+{
+   const audio_clip_desc_t *desc = &clipTable[clip];
+
+   audio_stop();
+#ifdef AUDIO_SPI_FLASH
+   if (desc->format == AUDIO_FORMAT_SPI_FLASH)
+   {
+      desc = openFlashClip(clip);
+      if (!desc)
+      {
+         // nothing valid to play, but the game still waits for a one-shot to finish
+         if (mode == audio_mode_once)
+         {
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+            {
+               pendingEvents |= EVENT_CLIP_DONE_bm;
+            }
+         }
+         return;
+      }
+      seekFlashClip(0);
+   }
+#endif
+   playingMode = mode;
+   clipIdx = 0;
+   adpcm_reset(&decoder);
+   loopDecoder = decoder;
+   siren_reset(&siren);
+   playingClip = desc;
+   audio_fill();
+
+   // the underflow interrupt is off since audio_stop(), so the ISR can't see half of a new step
+   sampleStep = (uint16_t) ((((uint32_t) playingClip->sampleRate << 16) + AUDIO_CARRIER_HZ / 2) / AUDIO_CARRIER_HZ);
+   samplePhase = 0;
+   TCA0.SPLIT.INTFLAGS = TCA_SPLIT_LUNF_bm;
+   TCA0.SPLIT.INTCTRL = TCA_SPLIT_LUNF_bm;
+}
+
+/*!
+ * @brief Drop whatever is buffered and stop decoding and pacing samples, the PWM holds its last sample.
+ *  No EVENT_CLIP_DONE_bm is posted for the clip that was playing
+ *
+ * @param None
+ *
+ * @return None
+ */
+void audio_stop(void)
+{
+   playingClip = NULL;
+   TCA0.SPLIT.INTCTRL = 0;
+#ifdef AUDIO_SPI_FLASH
+   spiflash_end();
+#endif
+
+   // the ISR must not play a stale sample or report the old clip as done once the ring is emptied
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      ringTail = ringHead;
+      clipQueued = false;
+   }
+}
+
+/*!
+ * @brief Change how fast the siren sweeps, it takes effect from the next sample audio_fill() queues
+ *
+ * @param speed
+ *  Sweep rate in 1/SIREN_SPEED_NORMAL of the normal rate, see siren_setSpeed()
+ *
+ * @return None
+ */
+void audio_setSirenSpeed(uint8_t speed)
+{
+   siren_setSpeed(&siren, speed);
+}
+
+/*!
+ * @brief Decode samples of the playing clip into the ring buffer until it is full.
+ *  Called from the main loop on EVENT_AUDIO_bm, each sample is handed to the ISR as soon as it is decoded
+ *
+ * @param None
+ *
+ * @return None
+ */
+void audio_fill(void)
+{
+   BENCH_START(stamp);
+   uint8_t tail = ringTail;
+   uint8_t next = (tail + 1) & AUDIO_RING_MASK;
+
+   while (playingClip && (next != ringHead))
+   {
+      ring[tail] = nextSample();
+      if (playingClip)
+      {
+         ringTail = next;
+      }
+      else
+      {
+         // that was a one-shot's last sample, and the ISR may only count down to it once it is in the ring
+         ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+         {
+            ringTail = next;
+            clipQueued = true;
+         }
+      }
+      tail = next;
+      next = (tail + 1) & AUDIO_RING_MASK;
+   }
+   BENCH_STOP(stamp, bench_id_audio_fill);
+}
+
+/*!
+ * @brief Decode or synthesize the next sample of playingClip, looping or ending it at its last sample.
+ *  playingClip is NULL after the last sample of a one-shot clip
+ *
+ * @param None
+ *
+ * @return Unsigned 8 bit sample ready to be loaded into the PWM compare register
+ */
+static uint8_t nextSample(void)
+{
+   const audio_clip_desc_t *clip = playingClip;
+   audio_idx_t idx = clipIdx;
+   uint8_t sample;
+
+   // the ADPCM decoder can only pick up mid-clip from the state it had there
+   if (idx == clip->loopStart)
+   {
+      loopDecoder = decoder;
+   }
+
+   switch (clip->format)
+   {
+      case AUDIO_FORMAT_SIREN:
+         // synthesized rather than stored, so it never runs out
+         return siren_next(&siren);
+
+      case AUDIO_FORMAT_ADPCM4:
+         sample = adpcm_decode(&decoder, ADPCM_NIBBLE(clip->data, idx));
+         break;
+
+#ifdef AUDIO_SPI_FLASH
+      case AUDIO_FORMAT_SPI_FLASH:
+         sample = nextFlashSample(idx);
+         break;
+#endif
+
+      default:
+         sample = clip->data[idx];
+         break;
+   }
+
+   idx++;
+   if (idx >= clip->numSamples)
+   {
+      if (playingMode == audio_mode_loop)
+      {
+         idx = clip->loopStart;
+         decoder = loopDecoder;
+#ifdef AUDIO_SPI_FLASH
+         if (clip->format == AUDIO_FORMAT_SPI_FLASH)
+         {
+            seekFlashClip(idx);
+         }
+#endif
+      }
+      else
+      {
+         // audio_fill() tells the ISR once this sample is queued
+         playingClip = NULL;
+      }
+   }
+   clipIdx = idx;
+   return sample;
+}
+
+#ifdef AUDIO_SPI_FLASH
+/*!
+ * @brief Fill in flashClip from the external flash image's directory entry for 'clip'
+ *
+ * @param clip
+ *  The clip to look up, the directory is indexed by audio_clip_t
+ *
+ * @return &flashClip, or NULL if there is no valid image or no playable clip in that slot
+ */
+static const audio_clip_desc_t *openFlashClip(audio_clip_t clip)
+{
+   spiflash_header_t header;
+   spiflash_clip_t entry;
+
+   spiflash_read(0, &header, sizeof(header));
+   if ((header.magic != SPIFLASH_IMAGE_MAGIC) || (clip >= header.clipCount))
+   {
+      return NULL;
+   }
+
+   spiflash_read(SPIFLASH_DIR_ADDR + (uint32_t) clip * sizeof(entry), &entry, sizeof(entry));
+   if (((entry.format != AUDIO_FORMAT_PCM8) && (entry.format != AUDIO_FORMAT_ADPCM4)) || !entry.numSamples ||
+       (entry.loopStart >= entry.numSamples) ||
+       (entry.sampleRate < AUDIO_MIN_SAMPLE_RATE_HZ) || (entry.sampleRate > AUDIO_MAX_SAMPLE_RATE_HZ))
+   {
+      return NULL;
+   }
+
+   flashClip.data = NULL;
+   flashClip.numSamples = entry.numSamples;
+   flashClip.loopStart = entry.loopStart;
+   flashClip.sampleRate = entry.sampleRate;
+   flashClip.format = AUDIO_FORMAT_SPI_FLASH;
+   flashClipFormat = entry.format;
+   flashClipAddr = entry.offset;
+   return &flashClip;
+}
+
+/*!
+ * @brief Restart the flash read at sample 'idx' of flashClip
+ *
+ * @param idx
+ *  The next sample nextFlashSample() will be asked for
+ *
+ * @return None
+ */
+static void seekFlashClip(audio_idx_t idx)
+{
+   if (flashClipFormat == AUDIO_FORMAT_ADPCM4)
+   {
+      spiflash_stream(flashClipAddr + (idx >> 1));
+      // an odd sample is the high nibble of a byte that has to be read first
+      if (idx & 1)
+      {
+         flashByte = spiflash_next();
+      }
+   }
+   else
+   {
+      spiflash_stream(flashClipAddr + idx);
+   }
+}
+
+/*!
+ * @brief Stream in and decode sample 'idx' of flashClip, which must follow on from the sample before
+ *
+ * @param idx
+ *  The sample to produce
+ *
+ * @return Unsigned 8 bit sample ready to be loaded into the PWM compare register
+ */
+static uint8_t nextFlashSample(audio_idx_t idx)
+{
+   if (flashClipFormat != AUDIO_FORMAT_ADPCM4)
+   {
+      return spiflash_next();
+   }
+
+   // two codes to a byte, low nibble first
+   if (idx & 1)
+   {
+      return adpcm_decode(&decoder, flashByte >> 4);
+   }
+   flashByte = spiflash_next();
+   return adpcm_decode(&decoder, flashByte & 0x0F);
+}
+#endif /* AUDIO_SPI_FLASH */
+
+/*!
+ * @brief TCA interrupt at every PWM period, to load the next decoded audio sample into the PWM compare register
+ *  whenever the playing clip's sample period comes around. If the main loop fell behind the PWM simply holds the last sample
+ *
+ * @param TCA0_LUNF_vect
+ *  Unused parameter required by interface
+ *
+ * @return None
+ */
+ISR(TCA0_LUNF_vect)
+{
+   BENCH_START(stamp);
+   uint16_t phase = samplePhase;
+   uint16_t nextPhase = phase + sampleStep;
+   uint8_t head = ringHead;
+   uint8_t level;
+
+   TCA0.SPLIT.INTFLAGS = TCA_SPLIT_LUNF_bm;
+   samplePhase = nextPhase;
+
+   // the phase wraps once per sample period, and an empty ring is an underrun
+   if ((nextPhase < phase) && (head != ringTail))
+   {
+      TCA0.SPLIT.LCMP1 = ring[head];
+      head = (head + 1) & AUDIO_RING_MASK;
+      ringHead = head;
+
+      // the level only falls by one per sample here, so each threshold is hit exactly once on the way down
+      level = (ringTail - head) & AUDIO_RING_MASK;
+      if (level == AUDIO_RING_LOW_WATER)
+      {
+         pendingEvents |= EVENT_AUDIO_bm;
+      }
+      else if (!level && clipQueued)
+      {
+         clipQueued = false;
+         pendingEvents |= EVENT_CLIP_DONE_bm;
+      }
+   }
+   BENCH_STOP(stamp, bench_id_audio_isr);
+}
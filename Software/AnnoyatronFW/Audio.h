@@ -0,0 +1,65 @@
+/*!
+ * @file Audio.h
+ *
+ * Created: 10/16/2026
+ *
+ * Definitions and prototypes for audio playback through TCA0 PWM, with the samples decoded ahead of time
+ * by the main loop into a ring buffer that the TCA0 underflow ISR empties at each clip's own sample rate
+ *
+ */
+
+#include "stdint.h"
+#include "stdbool.h"
+
+#ifndef AUDIO_H_
+#define AUDIO_H_
+
+#define AUDIO_RING_LEN 64  ///< Samples of decoded audio buffered ahead of the PWM, must be a power of two no larger than 128
+#define AUDIO_RING_MASK (AUDIO_RING_LEN - 1)  ///< Wraps a ring buffer index
+#define AUDIO_RING_LOW_WATER (AUDIO_RING_LEN / 2)  ///< The TCA0 underflow ISR posts EVENT_AUDIO_bm when the buffer drains down to this many samples
+
+#define AUDIO_MAX_SAMPLE_RATE_HZ 16000  ///< Fastest clip sample rate, audio_fill() must decode at least this many samples per second
+#define AUDIO_FORMAT_SIREN 2  ///< Clip is not stored but synthesized by siren.c, alongside AUDIO_FORMAT_PCM8 and AUDIO_FORMAT_ADPCM4 in audioArrays.h
+#define AUDIO_FORMAT_SPI_FLASH 3  ///< Clip is streamed from the external flash, whose directory has the rest of its descriptor, see spiflash.h
+
+#ifdef AUDIO_SPI_FLASH
+typedef uint32_t audio_idx_t;  ///< Sample index into a clip, external clips can be much longer than 65535 samples
+#else
+typedef uint16_t audio_idx_t;  ///< Sample index into a clip
+#endif
+
+/** Clips audio_play() can play, each with an entry in clipTable in Audio.c */
+typedef enum audio_clip_enum
+{
+   audio_clip_siren,  ///< The countdown siren
+   audio_clip_win,  ///< The success clip
+   audio_clip_lose,  ///< The failure clip
+   audio_clip_count  ///< Number of clips, not a clip itself
+} audio_clip_t;
+
+/** How audio_play() plays a clip */
+typedef enum audio_mode_enum
+{
+   audio_mode_once,  ///< Play to the end, then post EVENT_CLIP_DONE_bm once the last sample is out
+   audio_mode_loop,  ///< Go back to the clip's loop point at the end, until audio_stop() or another audio_play()
+} audio_mode_t;
+
+/** Where a clip lives and how to play it, one per audio_clip_t in flash */
+typedef struct audio_clip_desc_struct
+{
+   const uint8_t *data;  ///< Stored samples, NULL for AUDIO_FORMAT_SIREN
+   audio_idx_t numSamples;  ///< Samples in the clip, ignored for AUDIO_FORMAT_SIREN which never ends
+   audio_idx_t loopStart;  ///< Sample to go back to at the end in audio_mode_loop
+   uint16_t sampleRate;  ///< Samples per second the clip was recorded or synthesized at, at most AUDIO_MAX_SAMPLE_RATE_HZ
+   uint8_t format;  ///< One of the AUDIO_FORMAT_* formats
+} audio_clip_desc_t;
+
+void audio_init(void);
+void audio_enable(bool isEnabled);
+void audio_play(audio_clip_t clip, audio_mode_t mode);
+void audio_stop(void);
+void audio_setSirenSpeed(uint8_t speed);
+void audio_fill(void);
+
+
+#endif /* AUDIO_H_ */
@@ -38,13 +38,44 @@
 
 
 #include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
 #include <util/delay.h>
 
 #include "I2C.h"
+#include "Timebase.h"
+#include "bench.h"
+#include "trace.h"
 
 #define NOP() asm volatile(" nop \r\n")  ///< Define a no-op action from assembly
 
-uint8_t timeout_cnt = 0; ///< count of consecutive timeouts
+/** One queued asynchronous transaction */
+typedef struct I2C_txn_struct
+{
+	uint8_t			slave_addr;									///< 8 bit device address, LSB 0
+	uint8_t			len;										///< number of bytes in buf to write, including the register
+	uint8_t			pos;										///< next byte in buf to write
+	uint8_t			read_len;									///< bytes left to read after the repeated start, 0 for write only
+	uint8_t			*read_ptr;									///< where the next byte read is stored
+	I2C_callback_t	callback;									///< called on completion, may be NULL
+	uint8_t			buf[MAX_LEN + 1];							///< slave register followed by the data to write
+} I2C_txn_t;
+
+volatile uint8_t timeout_cnt = 0; ///< msec since the current transfer step started, advanced by I2C_ms_tick()
+static volatile bool sync_active = false;						///< a blocking transfer is polling timeout_cnt
+static volatile bool abort_pending = false;						///< the transaction on the bus failed or timed out, left for I2C_service() to abort
+static volatile uint8_t abort_status;							///< status I2C_service() hands to the aborted transaction's callback, 0 to restart it instead
+
+static I2C_txn_t I2C_queue[I2C_QUEUE_LEN];						///< ring of queued transactions, I2C_head is on the bus
+static volatile uint8_t I2C_head = 0;							///< index of the transaction currently on the bus
+static volatile uint8_t I2C_count = 0;							///< number of queued transactions including the one on the bus
+
+static uint8_t I2C_enqueue(uint8_t slave_addr, uint8_t slave_reg, const uint8_t *addr_ptr, uint8_t write_len, uint8_t *read_ptr, uint8_t read_len, I2C_callback_t callback);
+static void I2C_begin(void);
+static void I2C_complete(uint8_t status);
+static void I2C_retire(uint8_t status);
+static void I2C_idle_sleep(void);
+static void I2C_sync_begin(void);
 
 /*!
  * @ingroup HardwareInit
@@ -275,11 +306,14 @@ uint8_t	I2C_read_bytes(uint8_t slave_addr, uint8_t *addr_ptr, uint8_t slave_reg,
 {
 	uint8_t status;
 	if (num_bytes > MAX_LEN) num_bytes = MAX_LEN;
+	I2C_wait_idle();												// don't interleave with queued transactions
+	I2C_sync_begin();												// the timeouts below count ms ticks
 	status = I2C_start(slave_addr & 0xfe);							// slave write address, LSB 0
 	if (status != 0) goto error;
 	status = I2C_wait_ACK();										// wait for slave ACK
 	if (status == 1) {
 		I2C_stop();													// NACK, abort
+		sync_active = false;
 		return 1;
 	}
 	if (status != 0) goto error;
@@ -295,10 +329,12 @@ uint8_t	I2C_read_bytes(uint8_t slave_addr, uint8_t *addr_ptr, uint8_t slave_reg,
 	status = I2C_read(addr_ptr, 1);									// single or last byte, send NACK
 	if (status != 0) goto error;
 	I2C_stop();
+	sync_active = false;
 	return 0;
 	
 error:
 	I2C_recover();													// clock out possibly stuck slave, reset master
+	sync_active = false;
 	return 0xff;													// flag error
 }
 
@@ -323,11 +359,14 @@ uint8_t	I2C_write_bytes(uint8_t slave_addr, uint8_t *addr_ptr, uint8_t slave_reg
 {
 	uint8_t status;
 	if (num_bytes > MAX_LEN) num_bytes = MAX_LEN;
+	I2C_wait_idle();												// don't interleave with queued transactions
+	I2C_sync_begin();												// the timeouts below count ms ticks
 	status = I2C_start(slave_addr & 0xfe);							// slave write address, LSB 0
 	if (status != 0) goto error;
 	status = I2C_wait_ACK();										// wait for Slave ACK
 	if (status == 1) {
 		I2C_stop();													// NACK, abort	
+		sync_active = false;
 		return 1;													
 	}	 										
 	if (status != 0) goto error;
@@ -340,10 +379,335 @@ uint8_t	I2C_write_bytes(uint8_t slave_addr, uint8_t *addr_ptr, uint8_t slave_reg
 		num_bytes--;		
 	}
 	I2C_stop();
+	sync_active = false;
 	return 0;
 
 error:
 	I2C_recover();
-   ledUsrBlink(0, 100);
+	sync_active = false;
 	return 0xff;
-}
\ No newline at end of file
+}
+
+/*!
+ * @brief Queue a write of several bytes to a register on a specified device, completed in the background
+ *
+ * @param slave_addr
+ *  Address of the device to be written to
+ *
+ * @param slave_reg
+ *  register on device to be written to, or the command byte if num_bytes is 0
+ *
+ * @param addr_ptr
+ *  pointer to the bytes to be written, copied into the queue before returning
+ *
+ * @param num_bytes
+ *  the number of bytes to write after slave_reg
+ *
+ * @param callback
+ *  called from the TWI0 interrupt, or from I2C_service() after a timeout, with the status when the write completes, may be NULL
+ *
+ * @return 0 once queued, else 0x10 if the queue is full and interrupts are disabled
+ */
+uint8_t I2C_queue_write(uint8_t slave_addr, uint8_t slave_reg, const uint8_t *addr_ptr, uint8_t num_bytes, I2C_callback_t callback)
+{
+	return I2C_enqueue(slave_addr, slave_reg, addr_ptr, num_bytes, 0, 0, callback);
+}
+
+/*!
+ * @brief Queue a read of several bytes from a register on a specified device, completed in the background
+ *
+ * @param slave_addr
+ *  Address of the device to be read from
+ *
+ * @param slave_reg
+ *  register on device to be read from
+ *
+ * @param addr_ptr
+ *  pointer to the buffer where read bytes should be received, must stay valid until the callback runs
+ *
+ * @param num_bytes
+ *  the number of bytes to read, at least 1
+ *
+ * @param callback
+ *  called from the TWI0 interrupt, or from I2C_service() after a timeout, with the status when the read completes, may be NULL
+ *
+ * @return 0 once queued, else 0x10 if the queue is full and interrupts are disabled
+ */
+uint8_t I2C_queue_read(uint8_t slave_addr, uint8_t slave_reg, uint8_t *addr_ptr, uint8_t num_bytes, I2C_callback_t callback)
+{
+	if (num_bytes == 0) num_bytes = 1;
+	return I2C_enqueue(slave_addr, slave_reg, 0, 0, addr_ptr, num_bytes, callback);
+}
+
+/*!
+ * @brief Check whether any queued transactions are still pending
+ *
+ * @return true if a transaction is on the bus or waiting for it, else false
+ */
+bool I2C_is_busy(void)
+{
+	return I2C_count != 0;
+}
+
+/*!
+ * @brief Sleep in IDLE until every queued transaction has completed.
+ *  Returns at once if interrupts are disabled, since the queue cannot make progress then
+ *
+ * @return None
+ */
+void I2C_wait_idle(void)
+{
+	if (!(SREG & CPU_I_bm)) return;
+
+	cli();
+	while (I2C_count)
+	{
+		if (abort_pending)											// a stuck transaction never drains by itself
+		{
+			sei();
+			I2C_service();
+			cli();
+		}
+		else I2C_idle_sleep();
+	}
+	sei();
+}
+
+/*!
+ * @brief Check whether the timeouts need the ms tick, the RTC only interrupts once a system tick otherwise
+ *
+ * @return true while a transaction is queued or a blocking transfer is running, else false
+ */
+bool I2C_needs_ms(void)
+{
+	return I2C_count || sync_active;
+}
+
+/*!
+ * @brief Advance timeout_cnt by the msec since the last call, and abort the queued transaction on the bus once it has taken longer than TXN_TIMEOUT.
+ *  Called from the ms tick interrupt, see Timebase.c
+ *
+ * @param ms
+ *  msec since the last call, 1 while I2C_needs_ms() said so
+ *
+ * @return None
+ */
+void I2C_ms_tick(uint8_t ms)
+{
+	if (timeout_cnt < 0xff - ms) timeout_cnt += ms;					// saturate, a timeout must not wrap back to zero
+	else timeout_cnt = 0xff;
+	if (I2C_count && timeout_cnt > TXN_TIMEOUT && !abort_pending)	// stuck slave or shorted SDA, the ISR will never get its flag
+	{
+		TWI0.MCTRLA &= ~(TWI_RIEN_bm | TWI_WIEN_bm);				// leave the transaction alone until I2C_service() aborts it
+		abort_status = 0xff;
+		abort_pending = true;										// the bus recovery takes too long for this ISR
+	}
+}
+
+/*!
+ * @brief Recover the bus after I2C_ms_tick() or the TWI0 ISR flagged the transaction at the head of the queue, then complete it
+ *  with the saved status and start the next, or restart it if I2C_begin() found a bus error left over before it went out.
+ *  Call from the main loop, the recovery bit-bangs SCL for tens of usec with interrupts enabled
+ *
+ * @return None
+ */
+void I2C_service(void)
+{
+	uint8_t sreg;
+
+	if (!abort_pending) return;
+
+	I2C_recover();													// TWI0 interrupts are off, and only the main loop queues transactions
+	sreg = SREG;
+	cli();
+	abort_pending = false;
+	if (abort_status) I2C_retire(abort_status);
+	else
+	{
+		I2C_begin();												// the bus is clear now, try the transaction once more
+		if (abort_pending)											// still a bus error, give up on it
+		{
+			abort_pending = false;
+			I2C_retire(4);
+		}
+	}
+	SREG = sreg;
+}
+
+/*!
+ * @brief Add a transaction to the queue, starting it if the bus is free
+ *
+ * @return 0 once queued, else 0x10 if the queue is full and interrupts are disabled
+ */
+static uint8_t I2C_enqueue(uint8_t slave_addr, uint8_t slave_reg, const uint8_t *addr_ptr, uint8_t write_len, uint8_t *read_ptr, uint8_t read_len, I2C_callback_t callback)
+{
+	I2C_txn_t *txn;
+	uint8_t i;
+	uint8_t sreg = SREG;
+	if (write_len > MAX_LEN) write_len = MAX_LEN;
+	if (read_len > MAX_LEN) read_len = MAX_LEN;
+
+	cli();
+	while (I2C_count == I2C_QUEUE_LEN)								// queue full, wait for the ISR to retire a transaction
+	{
+		if (!(sreg & CPU_I_bm)) 
+		{
+			SREG = sreg;
+			return 0x10;											// ISR can't run, waiting would hang
+		}
+		if (abort_pending)											// the head is stuck, abort it to free a slot
+		{
+			sei();
+			I2C_service();
+			cli();
+		}
+		else I2C_idle_sleep();
+	}
+
+	txn = &I2C_queue[(I2C_head + I2C_count) % I2C_QUEUE_LEN];
+	txn->slave_addr = slave_addr & 0xfe;
+	txn->len = write_len + 1;
+	txn->pos = 0;
+	txn->read_len = read_len;
+	txn->read_ptr = read_ptr;
+	txn->callback = callback;
+	txn->buf[0] = slave_reg;
+	for (i = 0; i < write_len; i++) txn->buf[i + 1] = addr_ptr[i];
+
+	if (++I2C_count == 1) I2C_begin();								// bus was free, start right away
+	SREG = sreg;
+	return 0;
+}
+
+/*!
+ * @brief Put the transaction at the head of the queue on the bus, called with interrupts disabled.
+ *  On a bus error left over it is flagged instead, for I2C_service() to recover the bus and restart it
+ *
+ * @return None
+ */
+static void I2C_begin(void)
+{
+	timeout_cnt = 0;												// TXN_TIMEOUT counts from here
+	timebase_needMs();												// on the next msec, not the next system tick
+	TWI0.MCTRLA |= TWI_RIEN_bm | TWI_WIEN_bm;						// ISR takes it from here
+	if (I2C_start(I2C_queue[I2C_head].slave_addr) != 0)				// bus error left over, and I2C_retire() may have called us from the TWI0 ISR
+	{
+		TWI0.MCTRLA &= ~(TWI_RIEN_bm | TWI_WIEN_bm);
+		abort_status = 0;											// nothing to complete, I2C_service() restarts it
+		abort_pending = true;
+	}
+}
+
+/*!
+ * @brief Retire the transaction at the head of the queue from the TWI0 ISR, or on a bus error or lost arbitration leave it for I2C_service() to recover the bus and abort
+ *
+ * @param status
+ *  The status code to hand to the transaction's callback
+ *
+ * @return None
+ */
+static void I2C_complete(uint8_t status)
+{
+	if (status > 1)													// bus error or arbitration lost, clocking out a possibly stuck slave takes too long for this ISR
+	{
+		TWI0.MCTRLA &= ~(TWI_RIEN_bm | TWI_WIEN_bm);
+		abort_status = status;
+		abort_pending = true;
+	}
+	else I2C_retire(status);
+}
+
+/*!
+ * @brief Retire the transaction at the head of the queue and start the next one, called with interrupts disabled
+ *
+ * @param status
+ *  The status code to hand to the transaction's callback
+ *
+ * @return None
+ */
+static void I2C_retire(uint8_t status)
+{
+	I2C_callback_t callback = I2C_queue[I2C_head].callback;
+
+	if (status) trace_emit(trace_type_i2c_error, status);				// callers carry on regardless, so log it
+	TWI0.MSTATUS = TWI_RIF_bm | TWI_WIF_bm;							// clear Read and Write interrupt flags
+
+	I2C_head = (I2C_head + 1) % I2C_QUEUE_LEN;
+	if (--I2C_count) I2C_begin();
+	else TWI0.MCTRLA &= ~(TWI_RIEN_bm | TWI_WIEN_bm);				// nothing left, stop interrupting
+
+	if (callback) callback(status);
+}
+
+/*!
+ * @brief Sleep in IDLE until the next interrupt, called and returning with interrupts disabled
+ *
+ * @return None
+ */
+static void I2C_idle_sleep(void)
+{
+	uint8_t sleep_ctrl = SLPCTRL.CTRLA;								// keep whatever sleep mode the caller had selected
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	sleep_enable();
+	sei();															// sei takes effect after the next instruction, so no wakeup is lost
+	sleep_cpu();
+	cli();
+	SLPCTRL.CTRLA = sleep_ctrl;
+}
+
+/*!
+ * @brief Mark a blocking transfer as running and bring the ms tick in for its timeouts
+ *
+ * @return None
+ */
+static void I2C_sync_begin(void)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+	sync_active = true;
+	timebase_needMs();
+	SREG = sreg;
+}
+
+/*!
+ * @ingroup ISRs
+ * @brief TWI0 master interrupt, steps the transaction at the head of the queue one byte at a time
+ *
+ * @param TWI0_TWIM_vect
+ *  Unused parameter required by interface
+ *
+ * @return None
+ */
+ISR(TWI0_TWIM_vect)
+{
+	BENCH_START(stamp);
+	I2C_txn_t *txn = &I2C_queue[I2C_head];
+	uint8_t status = TWI0.MSTATUS;
+
+	if (status & TWI_BUSERR_bm) I2C_complete(4);					// Bus Error, abort
+	else if (status & TWI_ARBLOST_bm) I2C_complete(2);				// Arbitration Lost, abort
+	else if (status & TWI_RIF_bm)									// data byte received
+	{
+		*txn->read_ptr++ = TWI0.MDATA;
+		if (--txn->read_len) TWI0.MCTRLB = TWI_MCMD_RECVTRANS_gc;	// send ACK, more bytes to follow
+		else
+		{
+			TWI0.MCTRLB = TWI_ACKACT_NACK_gc | TWI_MCMD_STOP_gc;	// send NACK and STOP after last byte
+			I2C_complete(0);
+		}
+	}
+	else if (status & TWI_RXACK_bm)									// Slave replied with NACK, abort
+	{
+		I2C_stop();
+		I2C_complete(1);
+	}
+	else if (txn->pos < txn->len) TWI0.MDATA = txn->buf[txn->pos++];	// register, then data bytes
+	else if (txn->read_len) TWI0.MADDR = txn->slave_addr | 1;		// repeated start with read address
+	else
+	{
+		I2C_stop();
+		I2C_complete(0);
+	}
+	BENCH_STOP(stamp, bench_id_twi_isr);
+}
@@ -43,13 +43,15 @@
 #define ADDR_TIMEOUT	5  ///< 5 ms address timeout
 #define READ_TIMEOUT	5  ///< 5 ms read timeout
 #define WRITE_TIMEOUT	5  ///< 5 ms write timeout
-#define MAX_LEN			8  ///< maximum number of bytes for read/write transaction
+#define TXN_TIMEOUT		10  ///< 10 ms limit for a whole queued transaction before it is aborted
+#define MAX_LEN			16  ///< maximum number of bytes for read/write transaction, enough for the whole HT16K33 display RAM
+#define I2C_QUEUE_LEN	4  ///< number of asynchronous transactions that can be queued at once
 
 /** Determine BAUD rate from clock freq and rise time */
 #define TWI0_BAUD(F_SCL, T_RISE)                                                                                       \
 ((((((float)20000000.0 / (float)F_SCL)) - 10 - ((float)20000000.0 * T_RISE / 1000000))) / 2)
 
-extern uint8_t timeout_cnt; 
+extern volatile uint8_t timeout_cnt; 
 
 // device addresses are 8 bit, LSB set if read
 // status returned from I2C transaction:
@@ -58,8 +60,12 @@ extern uint8_t timeout_cnt;
 // 2	arbitration lost
 // 4	bus error
 // 8	master does not control bus
+// 10	transaction queue full with interrupts disabled
 // ff	timeout
 
+/** Completion callback for a queued transaction, runs in the TWI0 interrupt with the transaction status, or from I2C_service() after a timeout, bus error or lost arbitration */
+typedef void (*I2C_callback_t)(uint8_t status);
+
 void		I2C_init();
 void		I2C_recover(void);							// clock out I2C bus if in invalid state (e.g. after incomplete transaction)
 uint8_t		I2C_start(uint8_t device_addr);				// 8 bit device address device_addr, LSB set if READ
@@ -88,4 +94,20 @@ void		I2C_stop();
 uint8_t		I2C_read_bytes(uint8_t slave_addr, uint8_t *addr_ptr, uint8_t slave_reg, uint8_t num_bytes);
 uint8_t		I2C_write_bytes(uint8_t slave_addr, uint8_t *addr_ptr, uint8_t slave_reg, uint8_t num_bytes);
 
+// interrupt driven transactions, queued and completed in order by ISR(TWI0_TWIM_vect)
+// the write data is copied into the queue, so the caller's buffer may be reused immediately
+// the read buffer must stay valid until the callback runs
+// num_bytes = 0 writes just slave_reg, e.g. for single byte device commands
+// callback may be NULL, it is handed the status codes listed above
+// if the queue is full the call sleeps in IDLE until a slot frees up
+// the blocking functions above wait for the queue to drain before touching the bus
+
+uint8_t		I2C_queue_write(uint8_t slave_addr, uint8_t slave_reg, const uint8_t *addr_ptr, uint8_t num_bytes, I2C_callback_t callback);
+uint8_t		I2C_queue_read(uint8_t slave_addr, uint8_t slave_reg, uint8_t *addr_ptr, uint8_t num_bytes, I2C_callback_t callback);
+bool		I2C_is_busy(void);							// true while queued transactions are pending
+bool		I2C_needs_ms(void);							// true while the timeouts need the ms tick rather than the system tick
+void		I2C_wait_idle(void);						// sleep in IDLE until the queue is empty, e.g. before a deeper sleep mode
+void		I2C_ms_tick(uint8_t ms);				// call from the ms tick interrupt with the msec since the last call, advances timeout_cnt and flags stuck transactions
+void		I2C_service(void);							// call from the main loop, aborts a transaction I2C_ms_tick() or the TWI0 ISR flagged and recovers the bus
+
 #endif /* I2C_H_ */
\ No newline at end of file
@@ -10,13 +10,20 @@
  *
  */ 
 
+#include <stddef.h>
 #include "main.h"
 #include "SevenSeg.h"
 #include "I2C.h"
+#include "bench.h"
 
-volatile uint8_t display_buffer[5] = {0};   ///< buffer for the four characters and the optional colon
+uint8_t display_buffer[SEVENSEG_RAM_LEN] = {0};   ///< image of the HT16K33 display RAM, the four characters and the optional colon at even addresses
+static uint8_t dirtyDigits = SEVENSEG_ALL_DIGITS_bm;  ///< bit per digit that changed since the last flush, all set so the first flush clears the HT16K33's power-up RAM
+static volatile bool displayWriteFailed = false;  ///< set by the I2C callback if a flush did not reach the display
+static volatile uint8_t blinkSetting = SEVENSEG_BLINK_UNKNOWN;  ///< blink rate last sent to the HT16K33, so repeats can be skipped
 
 static void SetSevenSegConfig(int configValue);
+static void sevenSegConfigDone(uint8_t status);
+static void sevenSegWriteDone(uint8_t status);
 
 
 /*!
@@ -33,18 +40,19 @@ void initSevenSeg(void)
 
    /* Enable HT16K33 display */
    SetSevenSegConfig(HT16K33_CMD_DISP_ON_NOBLINK);
+   blinkSetting = HT16K33_BLINK_OFF;
 
    /* Set dimming level to 16/16 */
    SetSevenSegConfig(HT16K33_CMD_DIM_LEVEL(0x08));
 
-   /* display_buffer is initialized to zero */
+   /* display_buffer is initialized to zero, and every digit starts dirty */
    writeAllDigits(SEVENSEG_NONE);
-   writeSevenSeg();
 }
 
 /*!
  * @brief Update one of the indices in the display buffer with a new value
- * to be written to the SevenSeg display next time writeSevenSeg() is called
+ * to be written to the SevenSeg display next time writeSevenSeg() is called.
+ * The digit is only marked dirty if its value actually changed
  *
  * @param index
  *  Index of the display char to update; 0-1 are the chars before the colon,
@@ -58,30 +66,61 @@ void initSevenSeg(void)
  */
 void setSevenSegValue(uint8_t index, sevenseg_digit_t value)
 {
-   if ( index > 5 || value > SEVENSEG_TABLE_LEN) return;
+   if ( index >= SEVENSEG_NUM_DIGITS || value >= SEVENSEG_TABLE_LEN) return;
 
-   /**
-    * display_buffer[2] controls the colon. 
-    * This will set colon unless value is one of {0, SEVENSEG_NONE} 
-    */
-   if ( index == 2)
+   // compare against the byte last stored, so an unchanged digit is never resent and a changed one always is
+   if (display_buffer[2 * index] != numbertable[value])
    {
-      display_buffer[index] =  (SEVENSEG_NONE) ? 0: (value) ? 0x02: 0;
+      display_buffer[2 * index] = numbertable[value];
+      dirtyDigits |= (1 << index);
    }
-   display_buffer[index] = numbertable[value];
 }
 
 /*!
- * @brief Write all the values currently in the display buffer to the SevenSeg display.
+ * @brief Flush the digits that changed since the last flush to the SevenSeg display.
+ *  The HT16K33 auto-increments its RAM address, so everything from the first to the last dirty digit
+ *  goes out in a single START...STOP burst; if nothing changed, nothing is sent at all.
+ *  Returns once the write is queued, the I2C interrupt sends it in the background
  *
  * @return None
  */
 void writeSevenSeg(void)
 {
-   for (int i = 0; i < 5; i++)
+   BENCH_START(stamp);
+   uint8_t first = 0;
+   uint8_t last = SEVENSEG_NUM_DIGITS - 1;
+
+   /* a write that didn't make it leaves the display unknown, so resend all of it */
+   if (displayWriteFailed)
    {
-      I2C_write_bytes(SEVENSEG_ADDR, &display_buffer[i], i * 2, 1);
+      displayWriteFailed = false;
+      dirtyDigits = SEVENSEG_ALL_DIGITS_bm;
+   }
+   // nothing changed is the common case, still timed so the mean is per call
+   if (dirtyDigits)
+   {
+      while (!(dirtyDigits & (1 << first))) first++;
+      while (!(dirtyDigits & (1 << last))) last--;
+
+      if (0 == I2C_queue_write(SEVENSEG_ADDR, 2 * first, &display_buffer[2 * first], 2 * (last - first) + 1, sevenSegWriteDone))
+      {
+         dirtyDigits = 0;
+      }
    }
+   BENCH_STOP(stamp, bench_id_sevenseg_write);
+}
+
+/*!
+ * @brief I2C completion callback for display flushes, schedules a full resend if the write failed
+ *
+ * @param status
+ *  The I2C status code of the finished flush, 0 for success
+ *
+ * @return None
+ */
+static void sevenSegWriteDone(uint8_t status)
+{
+   if (0 != status) displayWriteFailed = true;
 }
 
 
@@ -95,25 +134,12 @@ void writeSevenSeg(void)
  */
 void sevenSegBlink(uint8_t blinkSpeed)
 {
-   uint8_t writeCmdByte = 0;
-   uint8_t status = 0;
+   /* the display already blinks at this rate, don't spend a bus transaction on it */
+   if ((blinkSpeed & _HT16K33_BLINK_MASK) == blinkSetting) return;
+   blinkSetting = blinkSpeed & _HT16K33_BLINK_MASK;
 
    /* Set blink on or off based on provided boolean */
-   writeCmdByte = ( _HT16K33_DISP_SET_ADDR | _HT16K33_DISP_SET_DISPLAYON | (blinkSpeed & _HT16K33_BLINK_MASK));
-   I2C_start(SEVENSEG_ADDR);
-   status = I2C_wait_ACK();
-   if (0 != status)
-   {
-      ledUsrBlink(0, 500);
-   }
-
-   I2C_write(&writeCmdByte);
-   status = I2C_wait_ACK();
-   if (0 != status)
-   {
-      ledUsrBlink(0, 1000);
-   }
-   I2C_stop();
+   SetSevenSegConfig( _HT16K33_DISP_SET_ADDR | _HT16K33_DISP_SET_DISPLAYON | blinkSetting);
 }
 
 
@@ -139,7 +165,7 @@ void writeAllDigits(uint8_t value)
 }
 
 /*!
- * @brief Set a single config value in the HT16K33 
+ * @brief Queue a single config value to be set in the HT16K33 
  *
  * @param configValue
  *  A single configuration value to set on HT16K33- see documentation for examples
@@ -148,15 +174,24 @@ void writeAllDigits(uint8_t value)
  */
 static void SetSevenSegConfig(int configValue)
 {
-   uint8_t writeCmdByte = configValue;
-   uint8_t status; 
-   
-   I2C_start(SEVENSEG_ADDR);
-   status = I2C_wait_ACK();
-   if (0 != status) ledUsrBlink(0, 200);
-   
-   I2C_write(&writeCmdByte);
-   status = I2C_wait_ACK();
-   if (0 != status) ledUsrBlink(0, 100);
-   I2C_stop();
+   I2C_queue_write(SEVENSEG_ADDR, (uint8_t) configValue, NULL, 0, sevenSegConfigDone);
+}
+
+/*!
+ * @brief I2C completion callback for config writes. A failed write already cost the bus a recovery, so the game
+ *  carries on without that setting rather than halting over the display
+ *
+ * @param status
+ *  The I2C status code of the finished config write, 0 for success
+ *
+ * @return None
+ */
+static void sevenSegConfigDone(uint8_t status)
+{
+   // resend the digits and the blink rate too, the display may have lost them along with the setting
+   if (0 != status)
+   {
+      displayWriteFailed = true;
+      blinkSetting = SEVENSEG_BLINK_UNKNOWN;
+   }
 }
@@ -68,6 +68,10 @@ typedef enum sevenseg_digit_enum
 
 #define SEVENSEG_ADDR (0x70 << 1)  ///< The I2C address of the HT16K33 device
 
+#define SEVENSEG_NUM_DIGITS 5  ///< Four characters plus the colon in the middle
+#define SEVENSEG_RAM_LEN (2 * SEVENSEG_NUM_DIGITS)  ///< Bytes of HT16K33 display RAM used, each digit is the low byte of a 16 bit row
+#define SEVENSEG_ALL_DIGITS_bm ((1 << SEVENSEG_NUM_DIGITS) - 1)  ///< Dirty bit mask covering every digit
+
 #define _HT16K33_SYS_SETUP_ADDR 0x20  ///< System setup address to be logical OR'ed with SETUP commands
 #define _HT16K33_SYS_SETUP_OSC_ON  0x01  ///< Setup command to turn HT16K33 internal oscillator ON
 #define _HT16K33_SYS_SETUP_OSC_OFF 0x00  ///< Setup command to turn HT16K33 internal oscillator OFF
@@ -90,6 +94,7 @@ typedef enum sevenseg_blink_enum
 } sevenseg_blink_t;
 
 #define _HT16K33_BLINK_MASK  0x06 ///< Bitmask for all possible blink options
+#define SEVENSEG_BLINK_UNKNOWN  0xFF ///< Blink rate of the HT16K33 is not known, so the next sevenSegBlink() is always sent
 
 
 /* Public DISP commands */
@@ -102,7 +107,7 @@ typedef enum sevenseg_blink_enum
 /** Set dimming level using provided nybble (0x0F is brightest, 0x00 is dimmest) */
 #define HT16K33_CMD_DIM_LEVEL(dimNibble) (_HT16K33_DIM_ADDR + (dimNibble & 0x0F)) 
 
-extern volatile uint8_t display_buffer[5]; 
+extern uint8_t display_buffer[SEVENSEG_RAM_LEN];
 void initSevenSeg(void);
 void setSevenSegValue(uint8_t index, sevenseg_digit_t value);
 void writeSevenSeg(void);
@@ -0,0 +1,245 @@
+/*!
+ * @file Timebase.c
+ *
+ * System tick and msec counter on the RTC
+ *
+ * The RTC free-runs off OSCULP32K, which keeps going in STANDBY, and its compare match is moved
+ * forward at every interrupt. 32768 HZ does not divide evenly into msec, so the period is kept with
+ * 16 fractional bits and the compare match lands on the nearest RTC cycle- the error never builds up
+ * from one interrupt to the next. Every TIMEBASE_MS_PER_TICK msec the system tick handler runs.
+ * The compare only steps one msec at a time while the I2C timeouts need it, otherwise it goes straight
+ * on to the next tick so STANDBY is not broken up 1000 times a second. If an interrupt is serviced so
+ * late that the next compare would already be behind the count, it is stepped on until it is ahead
+ * and the msec skipped are counted at the next interrupt, rather than waiting 2 seconds for the RTC
+ * to wrap. OSCULP32K is only trimmed to a few percent, so timebase_init()
+ * first measures it against the factory calibrated OSC20M and derives the tick period from that.
+ *
+ */
+
+#include "main.h"
+#include "Timebase.h"
+#include "I2C.h"
+#include "bench.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+/** Msec in 1/65536ths of an RTC cycle when OSCULP32K runs at exactly TIMEBASE_RTC_HZ */
+#define MS_STEP_NOMINAL_Q16 ((TIMEBASE_RTC_HZ << 16) / TIMEBASE_MS_HZ)
+
+/** RTC cycles a new compare match must be ahead of the count, to allow for RTC.CMP synchronizing */
+#define CMP_MARGIN 3
+
+#if (F_CPU / TIMEBASE_RTC_HZ * TIMEBASE_CAL_RTC_CYCLES / 100 * (100 + TIMEBASE_CAL_TOLERANCE_PCT) > 0xFFFF)
+#error "TCB0 would overflow during the calibration, lower TIMEBASE_CAL_RTC_CYCLES"
+#endif
+
+static uint32_t calibrateMsStep(void);
+static void armCompare(uint8_t ms);
+
+static timebase_callback_t tickCallback;  ///< Called on every tick from the RTC ISR
+static uint32_t msStepQ16;  ///< Msec in 1/65536ths of an RTC cycle, from calibrateMsStep()
+static uint32_t nextCompareQ16;  ///< RTC count of the next interrupt in 1/65536ths, the integer part wraps along with RTC.CNT
+static uint8_t msPending;  ///< Msec the next interrupt accounts for, zero while the RTC ISR runs
+static uint8_t msUntilTick;  ///< Msec left until the next system tick
+static volatile uint16_t tickCount;  ///< Free-running count of ticks since timebase_init()
+static volatile uint32_t msCount;  ///< Free-running count of msec since timebase_init()
+
+/*!
+ * @brief Start the RTC and the system tick.
+ *  Borrows TCB0 for the calibration, so call this before anything else sets TCB0 up
+ *
+ * @param onTick
+ *  Handler to call from the RTC interrupt on every tick
+ *
+ * @return None
+ */
+void timebase_init(timebase_callback_t onTick)
+{
+   tickCallback = onTick;
+   tickCount = 0;
+   msCount = 0;
+   msUntilTick = TIMEBASE_MS_PER_TICK;
+
+   // free-run over the whole 16 bit range so the compare match can simply be advanced
+   while (RTC.STATUS);
+   RTC.CLKSEL = RTC_CLKSEL_INT32K_gc;
+   RTC.PER = 0xFFFF;
+   RTC.CTRLA = RTC_PRESCALER_DIV1_gc | RTC_RUNSTDBY_bm | RTC_RTCEN_bm;
+
+   msStepQ16 = calibrateMsStep();
+
+   nextCompareQ16 = (uint32_t) RTC.CNT << 16;
+   armCompare(1);
+   RTC.INTFLAGS = RTC_CMP_bm;
+   RTC.INTCTRL = RTC_CMP_bm;
+}
+
+/*!
+ * @brief Bring the next RTC interrupt forward to the next msec, for code that starts counting msec timeouts.
+ *  Until then the RTC may only interrupt once a tick. Call with interrupts disabled
+ *
+ * @param None
+ *
+ * @return None
+ */
+void timebase_needMs(void)
+{
+   // within the RTC ISR msPending is zero, and the ISR itself decides the next step once the handlers have run.
+   // A compare that already matched is left alone, its interrupt is due and moving it would count msec twice
+   if ((msPending > 1) && !(RTC.INTFLAGS & RTC_CMP_bm))
+   {
+      nextCompareQ16 -= msStepQ16 * msPending;
+      armCompare(1);
+   }
+}
+
+/*!
+ * @brief Return how many ticks have passed since timebase_init(), wrapping at 16 bits
+ *
+ * @param None
+ *
+ * @return The tick count
+ */
+uint16_t timebase_ticks(void)
+{
+   uint16_t ticks;
+
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      ticks = tickCount;
+   }
+   return ticks;
+}
+
+/*!
+ * @brief Return how many msec have passed since timebase_init(). Only counted to the tick while nothing needs msec
+ *
+ * @param None
+ *
+ * @return The msec count
+ */
+uint32_t timebase_ms(void)
+{
+   uint32_t ms;
+
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      ms = msCount;
+   }
+   return ms;
+}
+
+/*!
+ * @brief Return the low 16 bits of the msec count, which wrap every 65.5 seconds. Counted to the tick as timebase_ms().
+ *  Cheaper than timebase_ms() for callers that already have interrupts disabled, and only safe for them
+ *
+ * @param None
+ *
+ * @return The msec count modulo 65536
+ */
+uint16_t timebase_msLow(void)
+{
+   return (uint16_t) msCount;
+}
+
+/*!
+ * @brief Time TIMEBASE_CAL_RTC_CYCLES of the RTC with TCB0 on CLK_PER to find the real length of a msec.
+ *
+ * @param None
+ *
+ * @return Msec in 1/65536ths of an RTC cycle, or the nominal length if the measurement is implausible
+ */
+static uint32_t calibrateMsStep(void)
+{
+   // CLK_PER cycles per msec times the RTC cycles timed, so dividing by 'elapsed' leaves RTC cycles per msec
+   const uint32_t scaledCycles = (uint32_t) F_CPU * TIMEBASE_CAL_RTC_CYCLES / TIMEBASE_MS_HZ;
+   uint16_t rtcStart;
+   uint16_t elapsed;
+   uint32_t step;
+
+   TCB0.CTRLB = TCB_CNTMODE_INT_gc;
+   TCB0.CCMP = 0xFFFF;
+   TCB0.CNT = 0;
+
+   // line up with an RTC count edge so both ends of the measurement see the same synchronizer delay
+   rtcStart = RTC.CNT;
+   while (RTC.CNT == rtcStart);
+   TCB0.CTRLA = TCB_CLKSEL_CLKDIV1_gc | TCB_ENABLE_bm;
+   rtcStart = RTC.CNT;
+   while ((uint16_t) (RTC.CNT - rtcStart) < TIMEBASE_CAL_RTC_CYCLES);
+   elapsed = TCB0.CNT;
+   TCB0.CTRLA = 0;
+
+   if (!elapsed)
+   {
+      return MS_STEP_NOMINAL_Q16;
+   }
+
+   // integer and fractional parts separately, the whole Q16 quotient would overflow 32 bits on the way
+   step = ((scaledCycles / elapsed) << 16) | (((scaledCycles % elapsed) << 16) / elapsed);
+   if ((step < MS_STEP_NOMINAL_Q16 / 100 * (100 - TIMEBASE_CAL_TOLERANCE_PCT)) ||
+       (step > MS_STEP_NOMINAL_Q16 / 100 * (100 + TIMEBASE_CAL_TOLERANCE_PCT)))
+   {
+      return MS_STEP_NOMINAL_Q16;
+   }
+   return step;
+}
+
+/*!
+ * @brief Set the compare match 'ms' msec on from the last one, and on a msec at a time while that is not
+ *  safely ahead of the count. Called with interrupts disabled
+ *
+ * @param ms
+ *  Msec from the last compare match to the next, at least 1
+ *
+ * @return None
+ */
+static void armCompare(uint8_t ms)
+{
+   msPending = ms;
+   nextCompareQ16 += msStepQ16 * ms;
+   while ((int16_t) ((uint16_t) (nextCompareQ16 >> 16) - RTC.CNT) < CMP_MARGIN)
+   {
+      // serviced late, the msec stepped over are counted when the compare does come
+      msPending++;
+      nextCompareQ16 += msStepQ16;
+   }
+   while (RTC.STATUS & RTC_CMPBUSY_bm);
+   RTC.CMP = (uint16_t) (nextCompareQ16 >> 16);
+}
+
+/*!
+ * @ingroup ISRs
+ * @brief RTC compare interrupt every msec while the I2C timeouts need it, else every tick. Counts the msec
+ *  since the last one, runs the I2C timeouts and the tick handler, and schedules the next.
+ *
+ * @param RTC_CNT_vect
+ *  Unused parameter required by interface
+ *
+ * @return None
+ */
+ISR(RTC_CNT_vect)
+{
+   BENCH_START(stamp);
+   uint8_t ms = msPending;
+
+   RTC.INTFLAGS = RTC_CMP_bm;
+   msPending = 0;
+   msCount += ms;
+   I2C_ms_tick(ms);
+
+   // more than one tick only after a late interrupt, and each one still runs so the countdown keeps time
+   while (ms >= msUntilTick)
+   {
+      ms -= msUntilTick;
+      msUntilTick = TIMEBASE_MS_PER_TICK;
+      tickCount++;
+      tickCallback();
+   }
+   msUntilTick -= ms;
+
+   armCompare(I2C_needs_ms() ? 1 : msUntilTick);
+   BENCH_STOP(stamp, bench_id_rtc_isr);
+}
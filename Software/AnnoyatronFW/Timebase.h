@@ -0,0 +1,35 @@
+/*!
+ * @file Timebase.h
+ *
+ * Created: 10/16/2026
+ *
+ * Definitions and prototypes for the system tick and msec counter, kept by the RTC off the internal 32 kHz oscillator
+ *
+ */
+
+#include "stdint.h"
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+#define TIMEBASE_MS_HZ 1000  ///< Rate of the RTC interrupt in HZ while the I2C timeouts need msec, else it only comes once a tick
+#define TIMEBASE_TICK_HZ 100UL  ///< Rate of the system tick in HZ, one tick per centisecond
+#define TIMEBASE_MS_PER_TICK (TIMEBASE_MS_HZ / TIMEBASE_TICK_HZ)  ///< Msec per system tick
+#define TIMEBASE_RTC_HZ 32768UL  ///< Nominal frequency of OSCULP32K clocking the RTC
+#define TIMEBASE_CAL_RTC_CYCLES 128  ///< RTC cycles timed against CLK_PER by timebase_init() to calibrate the tick, short enough for TCB0 to count at F_CPU
+#define TIMEBASE_CAL_TOLERANCE_PCT 12  ///< Calibrations further than this from nominal are distrusted, OSCULP32K is only good to 10% over temperature
+
+/** Convert a duration in msec to whole system ticks */
+#define TIMEBASE_MS_TO_TICKS(ms) ((ms) * TIMEBASE_TICK_HZ / 1000)
+
+/** Tick handler, called from the RTC interrupt so it must be short */
+typedef void (*timebase_callback_t)(void);
+
+void timebase_init(timebase_callback_t onTick);
+void timebase_needMs(void);
+uint16_t timebase_ticks(void);
+uint32_t timebase_ms(void);
+uint16_t timebase_msLow(void);
+
+
+#endif /* TIMEBASE_H_ */
@@ -0,0 +1,87 @@
+/*!
+ * @file adpcm.c
+ *
+ * Streaming 4 bit IMA-ADPCM decoder
+ *
+ * The audio clips are stored compressed to half the size of raw 8 bit PCM, and decoded one
+ * sample at a time by audio_fill() in the main loop, which tops up the ring buffer that the TCA0
+ * underflow ISR plays from. The ring only hides jitter, so on average the main loop must still decode one
+ * sample per sample period on top of the ISR. Everything here is kept short and branch-light for
+ * that- see ADPCM_DECODE_MAX_CYCLES for the budget.
+ * The tables must match the encoder in audio/parseWaveFile.py exactly.
+ *
+ */
+
+#include "adpcm.h"
+
+/** IMA-ADPCM quantizer step sizes, indexed by adpcm_state_t.stepIndex */
+static const uint16_t stepTable[ADPCM_STEP_TABLE_LEN] = {
+   7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+   50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+   253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+   1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+   3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+   11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+   32767
+};
+
+/** Step index adjustment for each code magnitude (sign bit masked off) */
+static const int8_t indexTable[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+/*!
+ * @brief Reset a decoder to silence at the smallest step size, as the encoder expects at the start of a clip
+ *
+ * @param state
+ *  The decoder state to reset
+ *
+ * @return None
+ */
+void adpcm_reset(adpcm_state_t *state)
+{
+   state->predictor = 0;
+   state->stepIndex = 0;
+}
+
+/*!
+ * @brief Decode one 4 bit ADPCM code into the next 8 bit PWM sample
+ *
+ * @param state
+ *  The running decoder state for the clip being played
+ *
+ * @param code
+ *  The next 4 bit code from the clip, see ADPCM_NIBBLE()
+ *
+ * @return Unsigned 8 bit sample ready to be loaded into the PWM compare register
+ */
+uint8_t adpcm_decode(adpcm_state_t *state, uint8_t code)
+{
+   uint16_t step = stepTable[state->stepIndex];
+   uint16_t diff = step >> 3;
+   int32_t predictor = state->predictor;
+   int8_t stepIndex = state->stepIndex;
+
+   /* diff = (magnitude + 0.5) * step / 4, done with shifts since the magnitude is only three bits */
+   if (code & 4) diff += step;
+   if (code & 2) diff += step >> 1;
+   if (code & 1) diff += step >> 2;
+
+   if (code & 8)
+   {
+      predictor -= diff;
+      if (predictor < INT16_MIN) predictor = INT16_MIN;
+   }
+   else
+   {
+      predictor += diff;
+      if (predictor > INT16_MAX) predictor = INT16_MAX;
+   }
+   state->predictor = (int16_t) predictor;
+
+   stepIndex += indexTable[code & 7];
+   if (stepIndex < 0) stepIndex = 0;
+   else if (stepIndex >= ADPCM_STEP_TABLE_LEN) stepIndex = ADPCM_STEP_TABLE_LEN - 1;
+   state->stepIndex = (uint8_t) stepIndex;
+
+   /* keep the high byte and move it from signed to the PWM's unsigned midscale */
+   return (uint8_t) (((uint16_t) state->predictor >> 8) ^ 0x80);
+}
@@ -0,0 +1,40 @@
+/*!
+ * @file adpcm.h
+ *
+ * Created: 10/16/2026
+ *
+ * Definitions and prototypes for the streaming 4 bit IMA-ADPCM decoder used to play back
+ * the compressed clips in audioArrays.h
+ *
+ */
+
+#include "stdint.h"
+
+#ifndef ADPCM_H_
+#define ADPCM_H_
+
+#define ADPCM_STEP_TABLE_LEN 89  ///< Number of quantizer step sizes in the IMA-ADPCM step table
+
+/**
+ * Worst-case CPU cycles spent by one call of adpcm_decode(), including the call and return.
+ * Hand-counted from the AVRxt instruction timings for the longest path (all three magnitude bits set,
+ * predictor clamped, step index clamped). It is part of AUDIO_FILL_MAX_CYCLES, the cost for audio_fill()
+ * to queue one sample, and Audio.c checks that this plus the TCA0 underflow ISRs fit one period of the fastest clip
+ */
+#define ADPCM_DECODE_MAX_CYCLES 110
+
+/** Fetch the 4 bit code for sample 'idx' out of an ADPCM clip array, low nibble first */
+#define ADPCM_NIBBLE(clip, idx) (((idx) & 1) ? ((clip)[(idx) >> 1] >> 4) : ((clip)[(idx) >> 1] & 0x0F))
+
+/** Running state of the ADPCM decoder, must be reset before the first sample of every clip */
+typedef struct adpcm_state_struct
+{
+   int16_t predictor;  ///< Last decoded sample as signed 16 bit PCM
+   uint8_t stepIndex;  ///< Index into the quantizer step table
+} adpcm_state_t;
+
+void adpcm_reset(adpcm_state_t *state);
+uint8_t adpcm_decode(adpcm_state_t *state, uint8_t code);
+
+
+#endif /* ADPCM_H_ */
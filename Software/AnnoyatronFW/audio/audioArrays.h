@@ -1,13 +1,12 @@
 /*!
  * @file audioArrays.h
  *
- * Created: 1/30/2022 8:32:32 AM
+ * AUTOGENERATED by parseWaveFile.py for the AVR-Annoyatron, do not edit by hand
  *
- * Author: Chase E. Stewart for Hidden Layer Design
- *
- * Contains short audio samples in raw 8 bit array format
+ * Contains short audio samples, each at its own sample rate, either as raw 8 bit arrays or as
+ * 4 bit IMA-ADPCM arrays with two samples per byte and the low nibble first. See adpcm.h for the decoder
  * 
- * These are very carefully calculated to fit within the memory of the attiny1606 with the existing code  
+ * These are checked against the flash of the attiny1606 by the script that generates them
  */ 
 
 #include "stdint.h"
@@ -15,13 +14,21 @@
 #ifndef AUDIOARRAYS_H_
 #define AUDIOARRAYS_H_
 
-/** @hideinitializer The siren noise to loop repeatedly while countdown is active*/
-const uint8_t siren[] = {0x80, 0x88, 0x90, 0x98, 0xA0, 0xA8, 0xAF, 0xB6, 0xBC, 0xA3, 0x3F, 0x44, 0x4C, 0x54, 0x5C, 0x65, 0x6E, 0x76, 0x7F, 0x88, 0x91, 0x9A, 0xA2, 0xAB, 0xB3, 0xBB, 0xC0, 0x5C, 0x44, 0x4A, 0x51, 0x59, 0x61, 0x68, 0x70, 0x79, 0x81, 0x89, 0x92, 0x9A, 0xA3, 0xAC, 0xB5, 0xC0, 0xCF, 0x2D, 0x3C, 0x46, 0x50, 0x5A, 0x63, 0x6C, 0x75, 0x7E, 0x88, 0x91, 0x9A, 0xA3, 0xAD, 0xB6, 0xC1, 0xD0, 0x2E, 0x3E, 0x48, 0x51, 0x5A, 0x63, 0x6C, 0x75, 0x7E, 0x87, 0x90, 0x99, 0xA2, 0xAC, 0xB5, 0xC0, 0xCF, 0x2F, 0x3F, 0x49, 0x52, 0x5C, 0x64, 0x6D, 0x76, 0x7E, 0x87, 0x90, 0x98, 0xA1, 0xAA, 0xB4, 0xBE, 0xCD, 0x2F, 0x3E, 0x49, 0x53, 0x5D, 0x67, 0x70, 0x7A, 0x83, 0x8C, 0x95, 0x9E, 0xA7, 0xAF, 0xB7, 0xBD, 0x5E, 0x47, 0x4D, 0x55, 0x5D, 0x65, 0x6E, 0x76, 0x7F, 0x87, 0x90, 0x98, 0xA0, 0xA9, 0xB1, 0xB7, 0xA1, 0x42, 0x49, 0x51, 0x59, 0x62, 0x6B, 0x74, 0x7D, 0x86, 0x8E, 0x97, 0xA0, 0xA8, 0xB0, 0xB6, 0xA0, 0x43, 0x49, 0x51, 0x5A, 0x63, 0x6C, 0x76, 0x7F, 0x88, 0x91, 0x9A, 0xA3, 0xAC, 0xB4, 0xBB, 0x5E, 0x48, 0x4E, 0x56, 0x5F, 0x67, 0x70, 0x79, 0x82, 0x8B, 0x94, 0x9E, 0xA8, 0xB2, 0xBD, 0xCD, 0x34, 0x44, 0x4F, 0x59, 0x63, 0x6C, 0x76, 0x7F, 0x88, 0x92, 0x9B, 0xA3, 0xAC, 0xB4, 0xBB, 0x5F, 0x4A, 0x50, 0x58, 0x61, 0x69, 0x72, 0x7B, 0x84, 0x8C, 0x95, 0x9E, 0xA6, 0xAF, 0xB5, 0xA1, 0x46, 0x4D, 0x55, 0x5E, 0x67, 0x70, 0x79, 0x82, 0x8B, 0x94, 0x9D, 0xA6, 0xAE, 0xB5, 0xA0, 0x46, 0x4D, 0x56, 0x5F, 0x68, 0x72, 0x7B, 0x85, 0x8E, 0x98, 0xA1, 0xAA, 0xB3, 0xB9, 0x60, 0x4C, 0x52, 0x5A, 0x63, 0x6B, 0x74, 0x7D, 0x86, 0x8F, 0x99, 0xA2, 0xAD, 0xB7, 0xC7, 0x35, 0x44, 0x50, 0x5A, 0x65, 0x6F, 0x79, 0x83, 0x8D, 0x96, 0xA0, 0xA9, 0xB1, 0xB8, 0x60, 0x4C, 0x53, 0x5B, 0x64, 0x6D, 0x76, 0x7F, 0x87, 0x90, 0x99, 0xA2, 0xAA, 0xB1, 0x9D, 0x46, 0x4D, 0x55, 0x5F, 0x68, 0x71, 0x7B, 0x84, 0x8E, 0x98, 0xA2, 0xAC, 0xB8, 0xC7, 0x38, 0x47, 0x52, 0x5D, 0x67, 0x71, 0x7B, 0x84, 0x8E, 0x98, 0xA2, 0xAD, 0xB8, 0xC7, 0x39, 0x49, 0x54, 0x5E, 0x68, 0x72, 0x7C, 0x85, 0x8F, 0x98, 0xA1, 0xAA, 0xB1, 0x9E, 0x49, 0x50, 0x59, 0x62, 0x6C, 0x75, 0x7F, 0x89, 0x93, 0x9C, 0xA6, 0xAE, 0xB6, 0x61, 0x4E, 0x55, 0x5E, 0x67, 0x70, 0x79, 0x82, 0x8C, 0x95, 0x9F, 0xA9, 0xB4, 0xC4, 0x39, 0x49, 0x54, 0x5F, 0x6A, 0x74, 0x7E, 0x89, 0x92, 0x9C, 0xA6, 0xAF, 0xB6, 0x63, 0x50, 0x58, 0x60, 0x69, 0x72, 0x7B, 0x84, 0x8D, 0x96, 0x9F, 0xA8, 0xAF, 0x9D, 0x4A, 0x51, 0x5A, 0x63, 0x6D, 0x77, 0x80, 0x8A, 0x95, 0x9F, 0xA9, 0xB5, 0xC4, 0x3C, 0x4B, 0x57, 0x61, 0x6C, 0x76, 0x80, 0x8A, 0x94, 0x9F, 0xA9, 0xB4, 0xC4, 0x3C, 0x4C, 0x57, 0x61, 0x6C, 0x76, 0x80, 0x8A, 0x95, 0x9F, 0xAA, 0xB5, 0xC5, 0x3E, 0x4E, 0x59, 0x64, 0x6E, 0x78, 0x82, 0x8B, 0x95, 0x9E, 0xA7, 0xAE, 0x9D, 0x4D, 0x55, 0x5E, 0x67, 0x71, 0x7B, 0x86, 0x90, 0x9B, 0xA5, 0xB1, 0xC0, 0x3C, 0x4B, 0x57, 0x61, 0x6B, 0x75, 0x7F, 0x89, 0x93, 0x9D, 0xA8, 0xB3, 0xC2, 0x3F, 0x4E, 0x5A, 0x65, 0x6F, 0x7A, 0x84, 0x8E, 0x99, 0xA2, 0xAC, 0xB3, 0x65, 0x54, 0x5C, 0x65, 0x6E, 0x77, 0x80, 0x89, 0x92, 0x9B, 0xA4, 0xAB, 0x9B, 0x4D, 0x55, 0x5E, 0x67, 0x71, 0x7B, 0x85, 0x8F, 0x99, 0xA4, 0xB0, 0xBF, 0x3E, 0x4E, 0x5A, 0x65, 0x70, 0x7A, 0x85, 0x90, 0x9A, 0xA5, 0xB1, 0xC0, 0x40, 0x50, 0x5B, 0x66, 0x70, 0x7B, 0x85, 0x8F, 0x9A, 0xA4, 0xB0, 0xBF, 0x40, 0x4F, 0x5B, 0x66, 0x70, 0x7B, 0x85, 0x8F, 0x9A, 0xA5, 0xB0, 0xBF, 0x41, 0x50, 0x5B, 0x66, 0x70, 0x7A, 0x84, 0x8F, 0x99, 0xA3, 0xAF, 0xBE, 0x40, 0x50, 0x5B, 0x66, 0x70, 0x7A, 0x84, 0x8E, 0x98, 0xA1, 0xA9, 0x9A, 0x50, 0x58, 0x61, 0x6B, 0x75, 0x7F, 0x88, 0x92, 0x9C, 0xA5, 0xAD, 0x63, 0x54, 0x5C, 0x66, 0x70, 0x7A, 0x84, 0x8E, 0x99, 0xA3, 0xAF, 0xBE, 0x43, 0x52, 0x5E, 0x68, 0x73, 0x7D, 0x86, 0x90, 0x99, 0xA2, 0xAA, 0x9B, 0x52, 0x59, 0x62, 0x6C, 0x76, 0x80, 0x8A, 0x95, 0x9F, 0xAB, 0xBA, 0x42, 0x51, 0x5D, 0x68, 0x73, 0x7E, 0x88, 0x93, 0x9D, 0xA6, 0xAE, 0x66, 0x58, 0x60, 0x69, 0x72, 0x7B, 0x84, 0x8E, 0x97, 0xA0, 0xA7, 0x99, 0x51, 0x59, 0x63, 0x6C, 0x76, 0x81, 0x8B, 0x95, 0xA0, 0xAC, 0xBB, 0x44, 0x54, 0x5F, 0x6A, 0x75, 0x7F, 0x8A, 0x95, 0x9F, 0xAB, 0xBA, 0x44, 0x53, 0x5F, 0x69, 0x74, 0x7E, 0x89, 0x94, 0x9E, 0xAA, 0xB9, 0x44, 0x53, 0x5E, 0x69, 0x74, 0x7E, 0x89, 0x93, 0x9E, 0xAA, 0xB9, 0x44, 0x53, 0x5F, 0x6A, 0x74, 0x7F, 0x8A, 0x94, 0x9F, 0xAB, 0xBA, 0x46, 0x55, 0x61, 0x6B, 0x76, 0x80, 0x8A, 0x94, 0x9D, 0xA6, 0x98, 0x54, 0x5C, 0x66, 0x70, 0x7A, 0x83, 0x8D, 0x97, 0xA1, 0xA9, 0x65, 0x58, 0x61, 0x6A, 0x74, 0x7E, 0x88, 0x93, 0x9D, 0xA8, 0xB7, 0x46, 0x55, 0x60, 0x6B, 0x75, 0x7F, 0x8A, 0x94, 0x9F, 0xAB, 0xB9, 0x49, 0x58, 0x64, 0x6F, 0x79, 0x84, 0x8E, 0x98, 0xA1, 0xA9, 0x67, 0x5A, 0x62, 0x6B, 0x75, 0x7F, 0x89, 0x93, 0x9D, 0xA8, 0xB7, 0x49, 0x58, 0x63, 0x6E, 0x79, 0x84, 0x8E, 0x98, 0xA2, 0xAA, 0x69, 0x5D, 0x65, 0x6E, 0x77, 0x80, 0x89, 0x93, 0x9B, 0xA3, 0x96, 0x55, 0x5D, 0x67, 0x70, 0x7A, 0x85, 0x8F, 0x9A, 0xA5, 0xB4, 0x48, 0x57, 0x63, 0x6E, 0x79, 0x84, 0x8F, 0x9A, 0xA6, 0xB5, 0x49, 0x58, 0x64, 0x6E, 0x79, 0x83, 0x8D, 0x97, 0xA0, 0xA8, 0x68, 0x5C, 0x64, 0x6D, 0x76, 0x80, 0x89, 0x92, 0x9B, 0xA3, 0x97, 0x58, 0x60, 0x6A, 0x73, 0x7D, 0x87, 0x90, 0x9A, 0xA2, 0x96, 0x58, 0x60, 0x69, 0x73, 0x7D, 0x87, 0x90, 0x9A, 0xA2, 0x96, 0x58, 0x60, 0x6A, 0x73, 0x7D, 0x87, 0x90, 0x99, 0xA2, 0x96, 0x58, 0x61, 0x6A, 0x74, 0x7D, 0x87, 0x91, 0x9A, 0xA2, 0x97, 0x5A, 0x62, 0x6C, 0x76, 0x80, 0x8A, 0x93, 0x9D, 0xA5, 0x68, 0x5E, 0x66, 0x70, 0x79, 0x83, 0x8E, 0x98, 0xA3, 0xB1, 0x4B, 0x59, 0x65, 0x6F, 0x79, 0x84, 0x8E, 0x99, 0xA4, 0xB2, 0x4D, 0x5B, 0x66, 0x70, 0x7A, 0x85, 0x8E, 0x98, 0xA0, 0x96, 0x5B, 0x63, 0x6C, 0x76, 0x80, 0x89, 0x93, 0x9C, 0xA4, 0x69, 0x5F, 0x67, 0x70, 0x7A, 0x84, 0x8E, 0x98, 0xA3, 0xB1, 0x4E, 0x5D, 0x68, 0x72, 0x7D, 0x87, 0x91, 0x9A, 0xA2, 0x68, 0x5E, 0x66, 0x6F, 0x79, 0x83, 0x8D, 0x97, 0xA2, 0xB0, 0x4E, 0x5C, 0x68, 0x72, 0x7C, 0x87, 0x90, 0x9A, 0xA2, 0x69, 0x5F, 0x67, 0x70, 0x7A, 0x83, 0x8D, 0x97, 0xA2, 0xB0, 0x50, 0x5E, 0x69, 0x74, 0x7E, 0x89, 0x93, 0x9C, 0xA5, 0x6C, 0x62, 0x6A, 0x73, 0x7C, 0x85, 0x8E, 0x97, 0x9F, 0x94, 0x5C, 0x64, 0x6D, 0x77, 0x80, 0x8B, 0x95, 0xA0, 0xAE, 0x50, 0x5E, 0x6A, 0x75, 0x80, 0x8A, 0x95, 0xA1, 0xAF, 0x51, 0x5F, 0x6A, 0x75, 0x7F, 0x89, 0x92, 0x9C, 0xA4, 0x6D, 0x63, 0x6B, 0x74, 0x7E, 0x87, 0x90, 0x99, 0xA1, 0x6A, 0x61, 0x69, 0x72, 0x7B, 0x84, 0x8D, 0x96, 0x9E, 0x94, 0x5E, 0x66, 0x6F, 0x78, 0x82, 0x8B, 0x94, 0x9C, 0x93, 0x5D, 0x66, 0x6F, 0x78, 0x81, 0x8B, 0x94, 0x9C, 0x93, 0x5E, 0x66, 0x6F, 0x78, 0x81, 0x8B, 0x94, 0x9C, 0x93, 0x5E, 0x66, 0x6F, 0x78, 0x82, 0x8B, 0x94, 0x9C, 0x93, 0x5E, 0x67, 0x70, 0x79, 0x82, 0x8C, 0x95, 0x9D, 0x94, 0x60, 0x68, 0x72, 0x7B, 0x84, 0x8E, 0x97, 0x9F, 0x6C, 0x63, 0x6B, 0x75, 0x7E, 0x88, 0x92, 0x9D, 0xAA, 0x53, 0x60, 0x6B, 0x75, 0x7F, 0x89, 0x94, 0x9E, 0xAC, 0x55, 0x62, 0x6D, 0x77, 0x81, 0x8B, 0x95, 0x9F, 0xAD, 0x56, 0x64, 0x6E, 0x78, 0x82, 0x8C, 0x95, 0x9E, 0x6B, 0x63, 0x6C, 0x75, 0x7E, 0x88, 0x92, 0x9C, 0xA9, 0x54, 0x61, 0x6B, 0x75, 0x7F, 0x89, 0x93, 0x9E, 0xAB, 0x57, 0x64, 0x6E, 0x78, 0x82, 0x8C, 0x95, 0x9D, 0x6C, 0x65, 0x6D, 0x76, 0x80, 0x89, 0x93, 0x9D, 0xAA, 0x56, 0x63, 0x6D, 0x77, 0x80, 0x89, 0x92, 0x9A, 0x93, 0x62, 0x6B, 0x74, 0x7D, 0x87, 0x91, 0x9B, 0xA8, 0x56, 0x63, 0x6D, 0x77, 0x80, 0x89, 0x92, 0x9A, 0x92, 0x63, 0x6B, 0x74, 0x7E, 0x87, 0x91, 0x9C, 0xA9, 0x58, 0x65, 0x6F, 0x79, 0x83, 0x8C, 0x95, 0x9D, 0x6D, 0x66, 0x6D, 0x76, 0x7F, 0x88, 0x91, 0x9B, 0xA8, 0x58, 0x65, 0x70, 0x7A, 0x85, 0x8F, 0x9A, 0xA7, 0x58, 0x65, 0x70, 0x79, 0x83, 0x8C, 0x95, 0x9C, 0x6E, 0x67, 0x6E, 0x76, 0x7F, 0x87, 0x8F, 0x96, 0x8F, 0x61, 0x69, 0x71, 0x7B, 0x84, 0x8E, 0x98, 0xA5, 0x58, 0x65, 0x6F, 0x79, 0x84, 0x8E, 0x98, 0xA5, 0x59, 0x65, 0x70, 0x79, 0x83, 0x8C, 0x94, 0x9C, 0x6F, 0x68, 0x6F, 0x78, 0x80, 0x88, 0x91, 0x98, 0x91, 0x64, 0x6C, 0x74, 0x7D, 0x85, 0x8E, 0x95, 0x8E, 0x63, 0x6A, 0x73, 0x7C, 0x85, 0x8F, 0x99, 0xA5, 0x5B, 0x67, 0x71, 0x7B, 0x84, 0x8E, 0x98, 0xA4, 0x5B, 0x67, 0x71, 0x7B, 0x84, 0x8E, 0x98, 0xA4, 0x5A, 0x67, 0x71, 0x7A, 0x84, 0x8D, 0x97, 0xA3, 0x5B, 0x67, 0x71, 0x7A, 0x84, 0x8D, 0x97, 0xA3, 0x5B, 0x67, 0x71, 0x7A, 0x84, 0x8D, 0x97, 0xA3, 0x5C, 0x68, 0x72, 0x7B, 0x85, 0x8E, 0x98, 0xA4, 0x5D, 0x69, 0x72, 0x7C, 0x84, 0x8D, 0x94, 0x8E, 0x65, 0x6C, 0x75, 0x7D, 0x86, 0x8E, 0x95, 0x8F, 0x67, 0x6E, 0x77, 0x7F, 0x88, 0x90, 0x98, 0x6F, 0x6A, 0x71, 0x79, 0x82, 0x8A, 0x92, 0x9A, 0x71, 0x6C, 0x73, 0x7B, 0x84, 0x8D, 0x96, 0xA2, 0x5D, 0x69, 0x72, 0x7B, 0x84, 0x8D, 0x97, 0xA2, 0x5E, 0x6A, 0x73, 0x7C, 0x85, 0x8D, 0x95, 0x8F, 0x68, 0x6F, 0x78, 0x80, 0x88, 0x90, 0x98, 0x71, 0x6C, 0x73, 0x7C, 0x84, 0x8D, 0x96, 0xA2, 0x5F, 0x6A, 0x73, 0x7C, 0x84, 0x8D, 0x94, 0x8E, 0x68, 0x6F, 0x77, 0x80, 0x88, 0x90, 0x97, 0x71, 0x6B, 0x73, 0x7B, 0x83, 0x8C, 0x95, 0xA0, 0x5F, 0x6A, 0x73, 0x7B, 0x84, 0x8C, 0x94, 0x8F, 0x6A, 0x71, 0x79, 0x82, 0x8B, 0x94, 0x9F, 0x5F, 0x6A, 0x73, 0x7B, 0x84, 0x8C, 0x93, 0x8E, 0x69, 0x71, 0x79, 0x81, 0x8A, 0x92, 0x9D, 0x5E, 0x69, 0x72, 0x7B, 0x83, 0x8B, 0x92, 0x8D, 0x6A, 0x71, 0x79, 0x81, 0x8A, 0x92, 0x9D, 0x5F, 0x6A, 0x73, 0x7B, 0x83, 0x8B, 0x92, 0x8E, 0x6A, 0x72, 0x7A, 0x82, 0x8A, 0x93, 0x9E, 0x61, 0x6C, 0x75, 0x7D, 0x85, 0x8D, 0x94, 0x71, 0x6C, 0x73, 0x7B, 0x83, 0x8B, 0x94, 0x9E, 0x63, 0x6D, 0x76, 0x7F, 0x88, 0x91, 0x9C, 0x60, 0x6B, 0x73, 0x7C, 0x83, 0x8B, 0x92, 0x8D, 0x6B, 0x72, 0x79, 0x81, 0x89, 0x92, 0x9C, 0x62, 0x6D, 0x76, 0x7F, 0x88, 0x91, 0x9C, 0x62, 0x6D, 0x76, 0x7E, 0x86, 0x8D, 0x94, 0x72, 0x6E, 0x74, 0x7B, 0x82, 0x89, 0x8F, 0x8B, 0x6A, 0x70, 0x78, 0x80, 0x88, 0x90, 0x9B, 0x62, 0x6D, 0x76, 0x7F, 0x87, 0x90, 0x9B, 0x63, 0x6E, 0x76, 0x7E, 0x86, 0x8D, 0x94, 0x74, 0x6F, 0x76, 0x7D, 0x84, 0x8A, 0x91, 0x8C, 0x6C, 0x72, 0x79, 0x81, 0x88, 0x8E, 0x8A, 0x6A, 0x71, 0x79, 0x80, 0x88, 0x90, 0x9A, 0x64, 0x6E, 0x77, 0x7F, 0x87, 0x90, 0x9A, 0x64, 0x6F, 0x77, 0x7F, 0x87, 0x90, 0x9A, 0x65, 0x6F, 0x77, 0x80, 0x88, 0x90, 0x9A, 0x65, 0x6F, 0x77, 0x7F, 0x87, 0x8F, 0x99, 0x65, 0x6F, 0x77, 0x7E, 0x86, 0x8D, 0x93, 0x75, 0x72, 0x78, 0x7F, 0x86, 0x8D, 0x93, 0x75, 0x72, 0x78, 0x7F, 0x85, 0x8C, 0x92, 0x75, 0x71, 0x78, 0x7E, 0x85, 0x8C, 0x92, 0x75, 0x72, 0x78, 0x7F, 0x86, 0x8E, 0x97, 0x66, 0x6F, 0x77, 0x7F, 0x86, 0x8E, 0x98, 0x67, 0x70, 0x78, 0x80, 0x87, 0x8F, 0x98, 0x68, 0x71, 0x79, 0x80, 0x87, 0x8F, 0x98, 0x68, 0x71, 0x79, 0x80, 0x87, 0x8F, 0x98, 0x68, 0x71, 0x79, 0x80, 0x87, 0x8F, 0x98, 0x69, 0x72, 0x79, 0x80, 0x87, 0x8D, 0x8A, 0x6F, 0x76, 0x7C, 0x83, 0x89, 0x8F, 0x75, 0x71, 0x77, 0x7E, 0x84, 0x8B, 0x91, 0x76, 0x73, 0x79, 0x80, 0x86, 0x8E, 0x96, 0x68, 0x71, 0x79, 0x80, 0x87, 0x8E, 0x97, 0x69, 0x72, 0x79, 0x80, 0x87, 0x8C, 0x8A, 0x70, 0x76, 0x7C, 0x83, 0x89, 0x8F, 0x76, 0x73, 0x79, 0x7F, 0x86, 0x8D, 0x95, 0x69, 0x72, 0x79, 0x80, 0x86, 0x8E, 0x96, 0x6A, 0x73, 0x7A, 0x80, 0x87, 0x8C, 0x8A, 0x71, 0x77, 0x7E, 0x84, 0x8B, 0x94, 0x69, 0x71, 0x78, 0x7F, 0x86, 0x8D, 0x95, 0x6B, 0x73, 0x7A, 0x80, 0x86, 0x8C, 0x89, 0x72, 0x77, 0x7E, 0x84, 0x8B, 0x93, 0x6A, 0x72, 0x79, 0x80, 0x86, 0x8D, 0x95, 0x6D, 0x75, 0x7B, 0x82, 0x88, 0x8D, 0x76, 0x74, 0x79, 0x7F, 0x85, 0x8C, 0x93, 0x6B, 0x73, 0x79, 0x80, 0x86, 0x8B, 0x89, 0x72, 0x78, 0x7E, 0x84, 0x8B, 0x93, 0x6B, 0x73, 0x79, 0x80, 0x85, 0x8B, 0x89, 0x73, 0x78, 0x7E, 0x84, 0x8A, 0x92, 0x6B, 0x73, 0x79, 0x7F, 0x85, 0x8A, 0x88, 0x73, 0x78, 0x7E, 0x84, 0x8A, 0x91, 0x6C, 0x73, 0x79, 0x7F, 0x85, 0x8A, 0x88, 0x73, 0x78, 0x7E, 0x84, 0x8A, 0x91, 0x6C, 0x74, 0x7A, 0x80, 0x85, 0x8A, 0x88, 0x74, 0x79, 0x7F, 0x85, 0x8B, 0x92, 0x6E, 0x75, 0x7B, 0x81, 0x86, 0x8B, 0x77, 0x75, 0x7A, 0x80, 0x85, 0x8B, 0x92, 0x6F, 0x76, 0x7C, 0x82, 0x88, 0x8F, 0x6D, 0x74, 0x7A, 0x7F, 0x84, 0x89, 0x87, 0x74, 0x79, 0x7E, 0x84, 0x8A, 0x90, 0x6F, 0x76, 0x7B, 0x81, 0x86, 0x8B, 0x78, 0x76, 0x7A, 0x7F, 0x84, 0x89, 0x87, 0x74, 0x79, 0x7E, 0x83, 0x89, 0x90, 0x6F, 0x76, 0x7B, 0x81, 0x86, 0x8B, 0x78, 0x77, 0x7B, 0x80, 0x84, 0x89, 0x87, 0x75, 0x79, 0x7E, 0x83, 0x89, 0x8F, 0x70, 0x77, 0x7D, 0x82, 0x88, 0x8F, 0x70, 0x77, 0x7C, 0x81, 0x86, 0x8A, 0x79, 0x77, 0x7B, 0x80, 0x84, 0x88, 0x86, 0x75, 0x79, 0x7E, 0x83, 0x88, 0x8E, 0x71, 0x77, 0x7D, 0x82, 0x88, 0x8E, 0x71, 0x77, 0x7D, 0x82, 0x86, 0x8B, 0x7A, 0x79, 0x7D, 0x81, 0x85, 0x89, 0x79, 0x77, 0x7B, 0x7F, 0x83, 0x87, 0x86, 0x76, 0x7A, 0x7E, 0x83, 0x88, 0x8D, 0x72, 0x78, 0x7D, 0x82, 0x87, 0x8D, 0x72, 0x78, 0x7D, 0x82, 0x87, 0x8D, 0x72, 0x78, 0x7D, 0x82, 0x87, 0x8D, 0x72, 0x78, 0x7D, 0x81};
-	
+#define AUDIO_FORMAT_PCM8 0  ///< Clip is stored as unsigned 8 bit samples
+#define AUDIO_FORMAT_ADPCM4 1  ///< Clip is stored as 4 bit IMA-ADPCM codes
+
+#define YOUWIN_FORMAT AUDIO_FORMAT_ADPCM4  ///< Storage format of youWin
+#define YOUWIN_NUM_SAMPLES 3017  ///< Number of samples in youWin
+#define YOUWIN_SAMPLE_RATE_HZ 6510  ///< Sample rate of youWin in HZ
+#define YOUWIN_LOOP_START 0  ///< Sample of youWin that audio_mode_loop goes back to
 /** @hideinitializer The shutdown noise to play once after a success */
-const uint8_t youWin[] = {0x7F, 0x77, 0x70, 0x7E, 0x88, 0x8A, 0x97, 0x95, 0x81, 0x69, 0x6B, 0x68, 0x79, 0x91, 0x82, 0x7C, 0x8A, 0x85, 0x82, 0x85, 0x7A, 0x8C, 0x85, 0x72, 0x7E, 0x79, 0x75, 0x89, 0x8B, 0x7F, 0x80, 0x84, 0x75, 0x6E, 0x76, 0x76, 0x79, 0x8C, 0x94, 0x8E, 0x90, 0x96, 0x7C, 0x72, 0x6B, 0x60, 0x6C, 0x7E, 0x86, 0x9A, 0x9E, 0x9A, 0x79, 0x64, 0x70, 0x6F, 0x75, 0x86, 0x7F, 0x83, 0x91, 0x92, 0x86, 0x89, 0x72, 0x59, 0x67, 0x74, 0x80, 0x9D, 0xA8, 0x95, 0x95, 0x93, 0x80, 0x55, 0x4A, 0x5E, 0x74, 0x8A, 0xA4, 0x97, 0x6D, 0x77, 0x98, 0x7D, 0x7D, 0x89, 0x6B, 0x7E, 0x98, 0x7C, 0x86, 0x93, 0x65, 0x5C, 0x74, 0x67, 0x6D, 0x9F, 0xB0, 0xAD, 0x9F, 0x8B, 0x81, 0x5F, 0x47, 0x40, 0x5B, 0x73, 0x77, 0x8A, 0xCD, 0xBF, 0x87, 0x98, 0x7E, 0x6A, 0x90, 0x77, 0x5D, 0x79, 0x6B, 0x6C, 0x71, 0x59, 0x5E, 0x85, 0xA5, 0xA7, 0xAD, 0xB6, 0xAA, 0x8A, 0x67, 0x51, 0x50, 0x4E, 0x50, 0x64, 0x58, 0xB7, 0xDA, 0x82, 0x9A, 0xAA, 0x75, 0x98, 0x8F, 0x54, 0x78, 0x8A, 0x47, 0x48, 0x6F, 0x64, 0x6A, 0x98, 0xA6, 0xAD, 0xC0, 0xB5, 0x89, 0x73, 0x66, 0x42, 0x39, 0x50, 0x6D, 0x9C, 0xD6, 0x8E, 0x74, 0xB7, 0x88, 0x76, 0x92, 0x64, 0x6A, 0x81, 0x4F, 0x60, 0xA2, 0x63, 0x42, 0x8E, 0x9E, 0x96, 0xBC, 0xBC, 0xA7, 0xA3, 0x66, 0x39, 0x50, 0x4B, 0x37, 0x59, 0xC1, 0xDE, 0x65, 0x7F, 0xC8, 0x83, 0x87, 0x90, 0x61, 0x8D, 0x7F, 0x3F, 0x5F, 0x54, 0x64, 0x94, 0x6A, 0x73, 0xC2, 0xC7, 0xB1, 0xB6, 0xA4, 0x6E, 0x4D, 0x40, 0x28, 0x43, 0x64, 0x9C, 0xE2, 0x7C, 0x76, 0xDC, 0x86, 0x68, 0x9D, 0x6B, 0x71, 0x79, 0x45, 0x68, 0x96, 0x6D, 0x41, 0x8D, 0xAF, 0x8A, 0xA7, 0xBE, 0xAD, 0xA0, 0x6D, 0x3A, 0x47, 0x49, 0x3C, 0x57, 0x8B, 0xEA, 0xA2, 0x68, 0xE5, 0xAE, 0x60, 0x9E, 0x72, 0x57, 0x6E, 0x3E, 0x54, 0x7D, 0x33, 0x88, 0xCC, 0x62, 0x9D, 0xE6, 0x9E, 0x9B, 0xA4, 0x5D, 0x59, 0x53, 0x2C, 0x4C, 0x76, 0xA1, 0xCF, 0x73, 0x93, 0xE1, 0x65, 0x72, 0xB2, 0x58, 0x5D, 0x65, 0x44, 0x68, 0x5B, 0x6D, 0xD3, 0x72, 0x73, 0xEE, 0xA5, 0x88, 0xB6, 0x75, 0x59, 0x57, 0x35, 0x57, 0x66, 0x65, 0xC3, 0xB3, 0x40, 0xC8, 0xB9, 0x39, 0xBB, 0x9B, 0x47, 0x89, 0x59, 0x5D, 0x67, 0x44, 0x94, 0x64, 0x99, 0xD3, 0x65, 0xC1, 0xD7, 0x67, 0x9C, 0x72, 0x3E, 0x76, 0x3B, 0x40, 0x8B, 0x68, 0x56, 0xD4, 0xB3, 0x4C, 0xE9, 0xB0, 0x5B, 0xBB, 0x75, 0x52, 0x53, 0x4A, 0x64, 0x4B, 0x86, 0x84, 0x88, 0xC6, 0x8E, 0xAB, 0xBE, 0x85, 0x8B, 0x6B, 0x61, 0x4E, 0x42, 0x6C, 0x5F, 0x7F, 0x70, 0xCE, 0xAE, 0x51, 0xF4, 0x8C, 0x68, 0xB1, 0x67, 0x5C, 0x4A, 0x69, 0x49, 0x46, 0x96, 0x85, 0xB3, 0x8D, 0xB8, 0xBA, 0x8A, 0xAA, 0x6C, 0x6F, 0x4E, 0x47, 0x63, 0x54, 0x88, 0x8C, 0xC3, 0x71, 0x81, 0xC1, 0x2F, 0xAB, 0xA1, 0x7E, 0x80, 0x99, 0x7E, 0x36, 0x7B, 0x50, 0x51, 0x77, 0xA0, 0xAB, 0x82, 0xBE, 0xA9, 0xA4, 0x82, 0x82, 0x67, 0x57, 0x51, 0x5C, 0x65, 0x63, 0x9E, 0xA6, 0x5E, 0xA5, 0x9B, 0x62, 0xAD, 0x9C, 0x8E, 0x87, 0xA4, 0x57, 0x64, 0x57, 0x51, 0x4C, 0x72, 0xA2, 0x83, 0xA9, 0xC2, 0x9C, 0xA1, 0x9F, 0x76, 0x5B, 0x5E, 0x4F, 0x4C, 0x57, 0x71, 0x7B, 0x89, 0xD3, 0xB6, 0x62, 0xA8, 0x9B, 0x61, 0x8B, 0xAB, 0x74, 0x69, 0x85, 0x38, 0x39, 0x5F, 0x63, 0x66, 0xD0, 0xAA, 0xAE, 0xB2, 0xB7, 0x86, 0x84, 0x6D, 0x5C, 0x59, 0x4F, 0x5A, 0x6A, 0x69, 0x89, 0xA8, 0xB8, 0x73, 0x97, 0x8E, 0x73, 0x7E, 0xA6, 0x94, 0x7C, 0x93, 0x69, 0x4D, 0x4E, 0x5E, 0x50, 0x70, 0xA3, 0xAE, 0xB3, 0xA6, 0xA9, 0x9C, 0x85, 0x79, 0x61, 0x5C, 0x51, 0x5D, 0x5B, 0x63, 0x82, 0x8A, 0x98, 0xC5, 0x90, 0x8F, 0x91, 0x71, 0x84, 0x8C, 0x92, 0x79, 0x81, 0x70, 0x48, 0x5C, 0x4C, 0x60, 0x78, 0x96, 0xC3, 0xAC, 0xA7, 0xA9, 0x98, 0x7C, 0x78, 0x66, 0x5A, 0x63, 0x54, 0x61, 0x6F, 0x6D, 0x88, 0x99, 0x92, 0xB2, 0xA6, 0x73, 0x8A, 0x81, 0x7D, 0x8F, 0x8C, 0x86, 0x78, 0x61, 0x5E, 0x51, 0x4A, 0x65, 0x7F, 0x96, 0xBC, 0xBF, 0x9F, 0xA0, 0x8B, 0x7A, 0x7B, 0x55, 0x6A, 0x71, 0x5F, 0x63, 0x6F, 0x72, 0x7B, 0x94, 0x9A, 0x9C, 0xAD, 0x97, 0x7B, 0x6E, 0x74, 0x79, 0x77, 0x86, 0x92, 0x80, 0x74, 0x6F, 0x51, 0x61, 0x68, 0x7C, 0x9A, 0x97, 0xA8, 0xAC, 0x9D, 0x89, 0x99, 0x78, 0x61, 0x6E, 0x52, 0x56, 0x5E, 0x68, 0x72, 0x92, 0x9E, 0xAA, 0xA8, 0xAF, 0xA3, 0x66, 0x67, 0x6B, 0x55, 0x6F, 0x8B, 0x8C, 0x86, 0x91, 0x7D, 0x60, 0x5B, 0x6C, 0x77, 0x7D, 0xAB, 0xA8, 0x9D, 0x99, 0x95, 0x91, 0x81, 0x60, 0x70, 0x61, 0x4E, 0x5E, 0x66, 0x61, 0x8A, 0xA6, 0xAD, 0xA4, 0x9F, 0x97, 0xA8, 0x75, 0x55, 0x5C, 0x52, 0x6F, 0x7A, 0x8B, 0x9D, 0x9D, 0x88, 0x7D, 0x72, 0x57, 0x73, 0x72, 0x81, 0x9A, 0x99, 0x94, 0x9C, 0x8C, 0x88, 0x87, 0x6A, 0x74, 0x5B, 0x58, 0x65, 0x62, 0x78, 0x99, 0xA2, 0xA7, 0xA3, 0x97, 0x98, 0x8F, 0x6F, 0x54, 0x4A, 0x56, 0x76, 0x80, 0x8A, 0xAA, 0xAA, 0x92, 0x84, 0x6B, 0x5F, 0x59, 0x6C, 0x75, 0x92, 0x9B, 0xA1, 0xA0, 0x96, 0x94, 0x79, 0x67, 0x6E, 0x63, 0x4B, 0x61, 0x69, 0x88, 0x89, 0xA4, 0xB6, 0x9C, 0x97, 0x7F, 0x7F, 0x89, 0x6A, 0x5D, 0x48, 0x73, 0x83, 0x83, 0x9A, 0x98, 0xA4, 0x93, 0x63, 0x67, 0x67, 0x66, 0x6E, 0x83, 0x8F, 0x8C, 0x9F, 0x95, 0x8F, 0xA6, 0x83, 0x7D, 0x6B, 0x60, 0x4C, 0x4A, 0x6B, 0x72, 0x9B, 0xA1, 0xAE, 0xAE, 0x8A, 0x84, 0x80, 0x73, 0x7C, 0x7E, 0x65, 0x59, 0x63, 0x7D, 0x88, 0x8D, 0x96, 0x93, 0x99, 0x82, 0x6F, 0x66, 0x6D, 0x78, 0x72, 0x96, 0x82, 0x90, 0x9F, 0x91, 0x97, 0x78, 0x78, 0x6B, 0x54, 0x63, 0x63, 0x76, 0x7A, 0x97, 0xAB, 0x91, 0xA0, 0x96, 0x7C, 0x78, 0x71, 0x78, 0x6A, 0x78, 0x6B, 0x5D, 0x87, 0x83, 0x9B, 0x9C, 0x94, 0x8B, 0x77, 0x7B, 0x67, 0x60, 0x68, 0x83, 0x8A, 0x8E, 0x80, 0x93, 0x9E, 0xA8, 0x92, 0x82, 0x6F, 0x50, 0x5E, 0x54, 0x59, 0x6A, 0x89, 0xA5, 0xB2, 0x9E, 0x95, 0x8F, 0x87, 0x8A, 0x79, 0x70, 0x68, 0x7C, 0x65, 0x54, 0x59, 0x72, 0xA3, 0xA6, 0x9E, 0x8E, 0x96, 0x8B, 0x79, 0x6E, 0x60, 0x6A, 0x7A, 0x83, 0x79, 0x86, 0x98, 0xA1, 0x9F, 0x88, 0x67, 0x5B, 0x5D, 0x66, 0x67, 0x6F, 0x91, 0xAA, 0xA4, 0xA4, 0x88, 0x81, 0x7B, 0x78, 0x71, 0x61, 0x73, 0x7A, 0x75, 0x6D, 0x83, 0x96, 0x9B, 0x9D, 0x7D, 0x7F, 0x73, 0x75, 0x74, 0x72, 0x6F, 0x71, 0x85, 0x8A, 0x96, 0x99, 0xA8, 0x9A, 0x86, 0x7E, 0x53, 0x4A, 0x4C, 0x60, 0x6B, 0x91, 0xA6, 0xA9, 0xB2, 0x99, 0x91, 0x7F, 0x6F, 0x6E, 0x70, 0x70, 0x68, 0x75, 0x65, 0x71, 0x86, 0x8E, 0x9A, 0x93, 0x93, 0x80, 0x83, 0x82, 0x7E, 0x6E, 0x7A, 0x71, 0x75, 0x83, 0x85, 0x9C, 0x91, 0x8C, 0x72, 0x71, 0x6E, 0x65, 0x77, 0x6A, 0x87, 0x90, 0x9A, 0x9C, 0x77, 0x87, 0x7E, 0x8E, 0x87, 0x80, 0x80, 0x65, 0x75, 0x78, 0x58, 0x73, 0x7A, 0x86, 0xA2, 0x98, 0x9B, 0x87, 0x7E, 0x83, 0x6C, 0x7D, 0x64, 0x71, 0x72, 0x7F, 0x9C, 0x92, 0x96, 0x7B, 0x7A, 0x79, 0x6D, 0x74, 0x6A, 0x80, 0x85, 0x84, 0x8B, 0x88, 0x94, 0x93, 0x8A, 0x82, 0x75, 0x69, 0x73, 0x72, 0x89, 0x76, 0x7F, 0x6A, 0x7B, 0x83, 0x77, 0xA8, 0x98, 0x95, 0x87, 0x76, 0x7E, 0x6B, 0x6B, 0x6A, 0x6A, 0x7B, 0x8F, 0x95, 0x96, 0x8E, 0x7F, 0x75, 0x78, 0x75, 0x7A, 0x8D, 0x79, 0x8A, 0x80, 0x81, 0x8B, 0x6E, 0x81, 0x73, 0x78, 0x7C, 0x87, 0x8B, 0x7D, 0x79, 0x7D, 0x77, 0x8A, 0x88, 0x94, 0x9B, 0x78, 0x7E, 0x79, 0x6F, 0x5F, 0x6D, 0x7F, 0x6C, 0x92, 0x97, 0x90, 0x84, 0x8D, 0x8A, 0x74, 0x85, 0x78, 0x7E, 0x86, 0x74, 0x74, 0x7B, 0x80, 0x6E, 0x8C, 0x87, 0x83, 0x85, 0x80, 0x83, 0x81, 0x76, 0x69, 0x93, 0x7D, 0x8D, 0x94, 0x7A, 0x7E, 0x78, 0x83, 0x72, 0x7E, 0x77, 0x76, 0x89, 0x74, 0x7F, 0x85, 0x82, 0x83, 0x91, 0x89, 0x85, 0x7D, 0x81, 0x84, 0x81, 0x6D, 0x67, 0x8D, 0x70, 0x7B, 0x8A, 0x7B, 0x82, 0x86, 0x86, 0x7F, 0x8A, 0x80, 0x87, 0x8D, 0x76, 0x78, 0x7B, 0x78, 0x79, 0x8C, 0x79, 0x81, 0x78, 0x79, 0x7E, 0x79, 0x7D, 0x7B, 0xA4, 0x89, 0x8A, 0x89, 0x78, 0x75, 0x72, 0x79, 0x73, 0x7C, 0x77, 0x83, 0x89, 0x6E, 0x7C, 0x85, 0x8E, 0x8A, 0x94, 0x8A, 0x8A, 0x7B, 0x71, 0x7C, 0x72, 0x71, 0x70, 0x82, 0x79, 0x80, 0x89, 0x83, 0x8D, 0x89, 0x8C, 0x76, 0x86, 0x74, 0x7D, 0x88, 0x78, 0x8B, 0x7C, 0x84, 0x79, 0x73, 0x72, 0x74, 0x7C, 0x75, 0x93, 0x89, 0x97, 0x90, 0x86, 0x8C, 0x7D, 0x74, 0x6D, 0x7A, 0x67, 0x76, 0x77, 0x76, 0x83, 0x88, 0x98, 0x86, 0x97, 0x8A, 0x8D, 0x8C, 0x78, 0x75, 0x5D, 0x6A, 0x67, 0x77, 0x88, 0x8A, 0x89, 0x89, 0x95, 0x83, 0x92, 0x7D, 0x7A, 0x78, 0x77, 0x7E, 0x74, 0x7D, 0x78, 0x8C, 0x82, 0x81, 0x7D, 0x71, 0x7E, 0x7F, 0x89, 0x80, 0x91, 0x89, 0x8D, 0x84, 0x6D, 0x75, 0x6C, 0x81, 0x79, 0x82, 0x7C, 0x7E, 0x7F, 0x77, 0x94, 0x87, 0x93, 0x86, 0x84, 0x7B, 0x75, 0x75, 0x66, 0x7E, 0x7A, 0x87, 0x85, 0x87, 0x84, 0x81, 0x8A, 0x76, 0x81, 0x7D, 0x87, 0x78, 0x7F, 0x8F, 0x7D, 0x7E, 0x81, 0x8B, 0x75, 0x73, 0x6E, 0x73, 0x77, 0x7A, 0x96, 0x94, 0x91, 0x80, 0x8F, 0x7D, 0x7D, 0x75, 0x78, 0x86, 0x67, 0x79, 0x78, 0x7D, 0x7A, 0x7C, 0x8D, 0x87, 0x8E, 0x87, 0x9B, 0x84, 0x7B, 0x75, 0x7A, 0x6E, 0x73, 0x80, 0x7A, 0x7D, 0x71, 0x80, 0x80, 0x7D, 0x96, 0x8D, 0x96, 0x80, 0x82, 0x77, 0x80, 0x7C, 0x6E, 0x84, 0x70, 0x74, 0x75, 0x86, 0x80, 0x8D, 0x81, 0x94, 0x7A, 0x87, 0x82, 0x80, 0x8E, 0x6F, 0x84, 0x72, 0x78, 0x7D, 0x65, 0x7E, 0x68, 0x88, 0x9E, 0xA1, 0x95, 0x76, 0x87, 0x74, 0x6D, 0x6A, 0x6D, 0x87, 0x81, 0x90, 0x8D, 0x81, 0x84, 0x7A, 0x78, 0x82, 0x74, 0x8B, 0x7C, 0x85, 0x8D, 0x71, 0x90, 0x78, 0x84, 0x89, 0x72, 0x64, 0x51, 0x7E, 0x95, 0xA7, 0xA8, 0x93, 0x7F, 0x67, 0x6A, 0x6B, 0x5F, 0x76, 0x89, 0x8F, 0x9A, 0x8D, 0x89, 0x89, 0x7E, 0x6E, 0x63, 0x80, 0x75, 0x8D, 0x7E, 0x7E, 0x89, 0x7B, 0x97, 0x91, 0x79, 0x6F, 0x62, 0x6A, 0x87, 0xA5, 0xB3, 0x8C, 0x68, 0x57, 0x5F, 0x6F, 0x6B, 0x78, 0x5F, 0x78, 0xAF, 0xC8, 0xD5, 0x9C, 0x74, 0x5E, 0x5A, 0x50, 0x43, 0x55, 0x66, 0x83, 0x9D, 0xA5, 0xB5, 0xB1, 0xA0, 0x86, 0x5A, 0x4A, 0x5F, 0x97, 0xA6, 0x99, 0x88, 0x62, 0x5B, 0x5E, 0x62, 0x67, 0x72, 0x7A, 0x8B, 0xA9, 0xC3, 0xDF, 0xC3, 0x76, 0x3E, 0x49, 0x52, 0x51, 0x4A, 0x54, 0x90, 0xA9, 0xA6, 0xA0, 0xAB, 0x9F, 0x80, 0x64, 0x5A, 0x86, 0xA7, 0xA8, 0x86, 0x60, 0x53, 0x5D, 0x61, 0x4E, 0x59, 0x7D, 0xAB, 0xB3, 0xB2, 0xB5, 0xBE, 0xB8, 0x73, 0x43, 0x31, 0x47, 0x5C, 0x5D, 0x62, 0x82, 0xB6, 0xB5, 0xA8, 0x9C, 0x91, 0x69, 0x62, 0x72, 0xA1, 0xAB, 0x85, 0x6A, 0x66, 0x64, 0x53, 0x44, 0x4F, 0x8C, 0xB1, 0xAA, 0xA4, 0xAB, 0xBD, 0xA7, 0x7C, 0x59, 0x5A, 0x5F, 0x45, 0x51, 0x6E, 0x88, 0x7F, 0x87, 0xA9, 0xBF, 0x9E, 0x5F, 0x6A, 0x90, 0x9B, 0x98, 0x9B, 0x90, 0x64, 0x46, 0x43, 0x46, 0x46, 0x72, 0xAD, 0xC2, 0xB5, 0xAD, 0xB6, 0x95, 0x7D, 0x72, 0x62, 0x4E, 0x53, 0x68, 0x63, 0x69, 0x7C, 0x8E, 0x9A, 0xA6, 0xA9, 0x81, 0x6F, 0x82, 0x94, 0xA6, 0xA2, 0x86, 0x62, 0x4E, 0x3F, 0x3C, 0x50, 0x71, 0xA2, 0xCA, 0xC3, 0xA8, 0x9C, 0x8D, 0x86, 0x81, 0x6F, 0x5D, 0x61, 0x60, 0x62, 0x61, 0x62, 0x82, 0x99, 0x9B, 0xA9, 0x92, 0x79, 0x7B, 0xA2, 0xB3, 0x99, 0x8A, 0x6F, 0x3D, 0x38, 0x43, 0x4C, 0x72, 0xAA, 0xC6, 0xBD, 0xA3, 0x93, 0x76, 0x7E, 0x8A, 0x87, 0x6F, 0x6B, 0x6B, 0x63, 0x64, 0x5A, 0x73, 0x8A, 0x9D, 0x8A, 0xA0, 0x74, 0x70, 0xB5, 0xAE, 0xA3, 0x8F, 0x7B, 0x3E, 0x38, 0x4A, 0x4A, 0x6A, 0xB1, 0xC7, 0xB4, 0x9E, 0x81, 0x75, 0x7C, 0x8C, 0x90, 0x77, 0x71, 0x6C, 0x62, 0x50, 0x5C, 0x73, 0x8D, 0x95, 0x98, 0xC0, 0x52, 0x8C, 0xB4, 0xAB, 0x8B, 0xA8, 0x61, 0x37, 0x43, 0x4F, 0x36, 0x75, 0xBE, 0xB2, 0xB0, 0xA9, 0x7A, 0x6C, 0x87, 0xA1, 0x8F, 0x82, 0x75, 0x63, 0x54, 0x51, 0x68, 0x5E, 0x74, 0xA0, 0x97, 0xE0, 0x3D, 0xA3, 0xAF, 0xA3, 0x9B, 0x99, 0x66, 0x2E, 0x51, 0x39, 0x44, 0x63, 0xAE, 0xB4, 0xC1, 0xA6, 0x7E, 0x80, 0x7F, 0x9B, 0x8C, 0x88, 0x73, 0x73, 0x65, 0x49, 0x5C, 0x56, 0x77, 0x92, 0x7A, 0xF1, 0x55, 0x7A, 0xEB, 0x7A, 0x9B, 0x86, 0x7C, 0x3F, 0x36, 0x71, 0x39, 0x6E, 0xA6, 0xB9, 0xB2, 0x80, 0x9E, 0x71, 0x70, 0x97, 0x88, 0x99, 0x6F, 0x6F, 0x69, 0x5C, 0x67, 0x4F, 0x86, 0x88, 0xB0, 0xD6, 0x28, 0xA7, 0xB8, 0x54, 0xB3, 0x89, 0x70, 0x5F, 0x43, 0x74, 0x41, 0x59, 0xAF, 0x9D, 0xA1, 0xAC, 0x94, 0x75, 0x71, 0x7A, 0x99, 0x90, 0x79, 0x93, 0x75, 0x5C, 0x56, 0x62, 0x7B, 0x73, 0xA4, 0x5F, 0xA2, 0xC1, 0x26, 0xB9, 0xC3, 0x6D, 0xA5, 0x54, 0x76, 0x6B, 0x27, 0x77, 0x7C, 0x82, 0xBB, 0x97, 0x96, 0x9C, 0x57, 0x74, 0x99, 0x7C, 0x9B, 0x93, 0x6C, 0x7B, 0x56, 0x58, 0x66, 0x6A, 0xA0, 0xA9, 0x4E, 0xA7, 0xBF, 0x2D, 0x98, 0xC3, 0x88, 0x9D, 0x58, 0x66, 0x7E, 0x28, 0x54, 0x89, 0x81, 0xBE, 0x92, 0x9F, 0xAD, 0x5A, 0x6B, 0x82, 0x7E, 0xA5, 0x7A, 0x72, 0x81, 0x6C, 0x62, 0x64, 0x65, 0x8C, 0xB6, 0xA5, 0x61, 0x68, 0xBB, 0x58, 0x6C, 0xBC, 0x92, 0xA6, 0x60, 0x54, 0x74, 0x3D, 0x53, 0x84, 0x8E, 0xB9, 0xAA, 0x97, 0xB0, 0x5F, 0x63, 0x8B, 0x73, 0x94, 0x87, 0x67, 0x6F, 0x65, 0x54, 0x62, 0x7B, 0x8C, 0xAD, 0x9F, 0xB7, 0xA8, 0x33, 0x79, 0x95, 0x77, 0xAC, 0x7D, 0x85, 0x86, 0x2F, 0x4C, 0x55, 0x5C, 0xAA, 0x9F, 0xB8, 0xCC, 0x87, 0x79, 0x77, 0x50, 0x84, 0x8C, 0x79, 0x95, 0x6F, 0x62, 0x62, 0x4F, 0x6D, 0x97, 0xA2, 0x96, 0xA1, 0xB3, 0x8B, 0x46, 0x83, 0x6C, 0x80, 0xAE, 0x82, 0x8F, 0x6B, 0x40, 0x50, 0x4F, 0x74, 0xA4, 0xA5, 0xBC, 0xB2, 0x90, 0x80, 0x51, 0x5F, 0x8B, 0x81, 0x95, 0x85, 0x68, 0x73, 0x57, 0x59, 0x81, 0x79, 0x8F, 0xB2, 0x97, 0xA4, 0xAE, 0x59, 0x5D, 0x78, 0x54, 0x97, 0x96, 0x87, 0xAA, 0x66, 0x5B, 0x56, 0x47, 0x85, 0x87, 0xA1, 0xC2, 0x95, 0xA2, 0x83, 0x4C, 0x67, 0x73, 0x8A, 0x9C, 0x85, 0x75, 0x64, 0x5C, 0x75, 0x6B, 0x87, 0xA4, 0x8E, 0x9C, 0x8F, 0x77, 0x99, 0x8B, 0x2E, 0x72, 0x80, 0xA2, 0xBD, 0x69, 0x8F, 0x67, 0x50, 0x5F, 0x48, 0x8B, 0xA6, 0xA3, 0xB8, 0x89, 0x7F, 0x7D, 0x5B, 0x78, 0x80, 0x8E, 0x9E, 0x7D, 0x70, 0x59, 0x67, 0x70, 0x71, 0x89, 0x8C, 0x91, 0x90, 0x94, 0x88, 0xB6, 0x75, 0x61, 0x78, 0x41, 0xAA, 0x86, 0x96, 0x9B, 0x5E, 0x76, 0x42, 0x56, 0x75, 0x78, 0xB9, 0xA8, 0xBE, 0x9C, 0x66, 0x76, 0x51, 0x84, 0x78, 0x85, 0xA2, 0x61, 0x78, 0x63, 0x57, 0x84, 0x6D, 0x8F, 0xAB, 0xA0, 0x9B, 0x77, 0x8B, 0x78, 0xA5, 0x5A, 0x72, 0x6E, 0x43, 0xA4, 0x6E, 0xA7, 0x9A, 0x74, 0x82, 0x59, 0x76, 0x69, 0x85, 0x8F, 0xA6, 0xB1, 0x79, 0x81, 0x57, 0x6D, 0x8C, 0x69, 0x9D, 0x8B, 0x82, 0x7A, 0x57, 0x6E, 0x6C, 0x81, 0x8F, 0x8E, 0x9D, 0x8A, 0x8E, 0x7E, 0x78, 0x91, 0x6F, 0x9B, 0x56, 0x7F, 0x62, 0x55, 0x99, 0x85, 0xBA, 0x8C, 0x98, 0x55, 0x63, 0x6E, 0x5A, 0x8F, 0x92, 0xB3, 0x91, 0x95, 0x69, 0x76, 0x73, 0x63, 0x98, 0x88, 0x94, 0x6C, 0x6C, 0x64, 0x63, 0x71, 0x81, 0xA0, 0x95, 0xAB, 0x87, 0x83, 0x88, 0x78, 0x7A, 0x76, 0x6A, 0x93, 0x85, 0x39, 0x64, 0x5D, 0xB2, 0x9F, 0xAE, 0x9D, 0x9C, 0x6D, 0x5C, 0x4F, 0x56, 0x7C, 0x95, 0x9D, 0xA0, 0x90, 0x7E, 0x74, 0x65, 0x7A, 0x7D, 0x8E, 0x91, 0x85, 0x73, 0x65, 0x65, 0x72, 0x81, 0x8B, 0x97, 0xA4, 0x95, 0x81, 0x77, 0x6E, 0x78, 0x7F, 0x76, 0x78, 0x8F, 0x80, 0x6A, 0x60, 0x7C, 0x86, 0x8C, 0x90, 0xA7, 0x97, 0x88, 0x78, 0x72, 0x69, 0x60, 0x75, 0x7D, 0x76, 0x78, 0x87, 0x90, 0x93, 0x9E, 0xA3, 0x8D, 0x75, 0x6C, 0x68, 0x4E, 0x55, 0x77, 0x7D, 0x8C, 0xA6, 0xAC, 0xA6, 0x90, 0x74, 0x77, 0x6C, 0x6A, 0x5F, 0x7C, 0x88, 0x7F, 0x6B, 0x77, 0x87, 0x89, 0x89, 0x98, 0xA2, 0x99, 0x8D, 0x75, 0x5C, 0x57, 0x5A, 0x6D, 0x72, 0x7F, 0xA9, 0xA3, 0x99, 0x99, 0x92, 0x8C, 0x77, 0x60, 0x60, 0x68, 0x62, 0x63, 0x71, 0x81, 0x99, 0xA4, 0xA9, 0x9D, 0x97, 0x83, 0x6E, 0x68, 0x6A, 0x5C, 0x77, 0x89, 0x7E, 0x74, 0x64, 0x8F, 0x88, 0x8C, 0xA0, 0xA7, 0x8F, 0x8B, 0x79, 0x69, 0x55, 0x59, 0x6F, 0x68, 0x73, 0x91, 0xA3, 0xA4, 0xA9, 0xA1, 0x96, 0x75, 0x5F, 0x54, 0x58, 0x53, 0x67, 0x79, 0x92, 0xA7, 0xA1, 0xA2, 0xA1, 0x8F, 0x79, 0x75, 0x60, 0x71, 0x65, 0x75, 0x87, 0x72, 0x80, 0x63, 0x80, 0x89, 0x8E, 0x9C, 0xAF, 0x96, 0x8D, 0x7B, 0x68, 0x56, 0x53, 0x6E, 0x72, 0x80, 0x80, 0x97, 0x97, 0xA7, 0x9E, 0x9D, 0x82, 0x72, 0x6E, 0x4A, 0x50, 0x5C, 0x6B, 0x8B, 0x97, 0xB0, 0xAB, 0x9D, 0x98, 0x85, 0x6E, 0x63, 0x64, 0x62, 0x72, 0x74, 0x79, 0x9E, 0x7F, 0x73, 0x7B, 0x8B, 0x91, 0x94, 0x96, 0x9C, 0x7D, 0x7F, 0x75, 0x5D, 0x5E, 0x72, 0x6D, 0x6A, 0x72, 0x8B, 0xA8, 0xA5, 0xAD, 0xAA, 0x8A, 0x7B, 0x5B, 0x44, 0x4F, 0x55, 0x69, 0x8D, 0x9C, 0xAD, 0xAD, 0x98, 0x99, 0x85, 0x77, 0x68, 0x5F, 0x6D, 0x6A, 0x6C, 0x77, 0x9F, 0x87, 0x8A, 0x68, 0x84, 0x7F, 0x8A, 0x93, 0x9D, 0x99, 0x8E, 0x81, 0x60, 0x5A, 0x56, 0x66, 0x65, 0x72, 0x9C, 0xA0, 0xA8, 0xAF, 0xAA, 0x8F, 0x72, 0x5D, 0x58, 0x47, 0x50, 0x66, 0x83, 0x9D, 0xA9, 0xA9, 0xA4, 0x94, 0x7D, 0x7A, 0x75, 0x6F, 0x6E, 0x63, 0x77, 0x7A, 0x72, 0x75, 0x6D, 0x92, 0x94, 0x9D, 0xA0, 0xA0, 0x88, 0x85, 0x6E, 0x5D, 0x5D, 0x5E, 0x74, 0x71, 0x7C, 0x91, 0x9A, 0xA2, 0xA8, 0x9A, 0x97, 0x76, 0x63, 0x63, 0x4A, 0x5C, 0x68, 0x7B, 0x8B, 0x96, 0xB2, 0xA1, 0x9D, 0x84, 0x8B, 0x79, 0x68, 0x59, 0x6B, 0x73, 0x82, 0x87, 0x79, 0x6D, 0x80, 0x85, 0x8B, 0x96, 0x98, 0x9F, 0x8E, 0x84, 0x70, 0x5B, 0x5D, 0x63, 0x6B, 0x73, 0x8B, 0x92, 0xA1, 0xA7, 0xA4, 0x9A, 0x86, 0x73, 0x66, 0x53, 0x49, 0x58, 0x67, 0x87, 0x95, 0xA7, 0xAC, 0xA9, 0x9D, 0x89, 0x73, 0x68, 0x69, 0x60, 0x6C, 0x6C, 0x97, 0x76, 0x78, 0x69, 0x8E, 0x81, 0x98, 0x9D, 0x99, 0x96, 0x8A, 0x80, 0x5F, 0x58, 0x5D, 0x67, 0x6C, 0x92, 0x95, 0x85, 0xA2, 0x9D, 0xA2, 0x8E, 0x82, 0x70, 0x68, 0x60, 0x4F, 0x58, 0x69, 0x86, 0x94, 0xA2, 0xA9, 0xA3, 0x9F, 0x82, 0x7F, 0x68, 0x6E, 0x61, 0x6B, 0x87, 0x7A, 0x71, 0x67, 0x7D, 0x80, 0x91, 0x9E, 0xA6, 0x9A, 0x8E, 0x83, 0x6D, 0x5B, 0x5A, 0x60, 0x67, 0x77, 0x94, 0xA9, 0x8E, 0xAD, 0x81, 0x9F, 0x67, 0x7C, 0x6A, 0x76, 0x64, 0x6D, 0x79, 0x6B, 0x7E, 0x79, 0x91, 0x8C, 0xA0, 0x9A, 0x98, 0x90, 0x87, 0x69, 0x6B, 0x65, 0x71, 0x7E, 0x7B, 0x5A, 0x73, 0x87, 0x8D, 0x98, 0x9F, 0xA0, 0x99, 0x8D, 0x72, 0x5B, 0x59, 0x5C, 0x65, 0x6B, 0x93, 0x99, 0xA7, 0xA3, 0xA4, 0x82, 0x7C, 0x6F, 0x69, 0x61, 0x67, 0x75, 0x7A, 0x84, 0x82, 0x8B, 0x87, 0x86, 0x83, 0x86, 0x86, 0x89, 0x8B, 0x87, 0x89, 0x77, 0x78, 0x73, 0x6A, 0x75, 0x76, 0x85, 0x94, 0x85, 0x70, 0x74, 0x87, 0x7A, 0x8B, 0x8E, 0x9F, 0x90, 0x8C, 0x7C, 0x68, 0x62, 0x59, 0x61, 0x6A, 0x85, 0x97, 0xA3, 0xA4, 0x9B, 0x94, 0x88, 0x74, 0x67, 0x69, 0x68, 0x73, 0x71, 0x7C, 0x7A, 0x80, 0x87, 0x86, 0x8C, 0x8C, 0x8D, 0x8F, 0x8C, 0x89, 0x7F, 0x7B, 0x71, 0x70, 0x6C, 0x70, 0x78, 0x88, 0x76, 0x8A, 0x73, 0xA1, 0x8A, 0x91, 0x7A, 0x78, 0x76, 0x72, 0x7C, 0x7D, 0x93, 0x8C, 0x96, 0x7F, 0x6E, 0x6D, 0x6C, 0x6F, 0x70, 0x7A, 0x83, 0x93, 0x94, 0x9B, 0x93, 0x9A, 0x7C, 0x7B, 0x61, 0x69, 0x5D, 0x6B, 0x78, 0x81, 0x90, 0x93, 0x9C, 0x93, 0x8F, 0x7D, 0x7B, 0x78, 0x7A, 0x6F, 0x76, 0x71, 0x7A, 0x83, 0x88, 0x86, 0x81, 0x88, 0x7E, 0x80, 0x75, 0x87, 0x7E, 0x82, 0x85, 0x8A, 0x88, 0x7C, 0x7F, 0x7A, 0x78, 0x76, 0x77, 0x7A, 0x7E, 0x7D, 0x7F, 0x87, 0x80, 0x88, 0x84, 0x8A, 0x87, 0x86, 0x85, 0x83, 0x72, 0x7B, 0x70, 0x7E, 0x74, 0x82, 0x7E, 0x8A, 0x77, 0x7E, 0x84, 0x84, 0x7F, 0x83, 0x88, 0x88, 0x81, 0x87, 0x80, 0x78, 0x67, 0x6E, 0x79, 0x8E, 0x97, 0x8A, 0x90, 0x7B, 0x8D, 0x65, 0x69, 0x6C, 0x78, 0x74, 0x83, 0x8A, 0x88, 0x91, 0x97, 0x92, 0x87, 0x89, 0x7F, 0x6B, 0x68, 0x6A, 0x6C, 0x79, 0x81, 0x8A, 0x87, 0x8C, 0x85, 0x80, 0x7B, 0x80, 0x7B, 0x86, 0x84, 0x8F, 0x85, 0x84, 0x79, 0x76, 0x6D, 0x77, 0x7D, 0x7B, 0x81, 0x86, 0x85, 0x86, 0x7B, 0x84, 0x7D, 0x86, 0x88, 0x84, 0x80, 0x76, 0x86, 0x6F, 0x7F, 0x77, 0x80, 0x75, 0x89, 0x83, 0x86, 0x84, 0x7D, 0x7D, 0x96, 0x73, 0x6F, 0x81, 0x90, 0x8F, 0x7A, 0x7A, 0x67, 0x70, 0x7A, 0x84, 0x84, 0x97, 0x8E, 0x8B, 0x75, 0x78, 0x74, 0x89, 0x76, 0x83, 0x6F, 0x88, 0x79, 0x8D, 0x7F, 0x83, 0x7E, 0x7F, 0x8A, 0x76, 0x7E, 0x81, 0x83, 0x78, 0x81, 0x78, 0x83, 0x7E, 0x8A, 0x88, 0x7B, 0x8D, 0x6B, 0x74, 0x78, 0x89, 0x80, 0x88, 0x88, 0x82, 0x7A, 0x7C, 0x7D, 0x90, 0x70, 0x71, 0x7A, 0x85, 0x88, 0x84, 0x83, 0x82, 0x85, 0x81, 0x80, 0x7A, 0x79, 0x7E, 0x82, 0x7D, 0x7A};
-			
+const uint8_t youWin[] = {0xFF, 0x7F, 0x77, 0x77, 0xDD, 0x80, 0x52, 0x8A, 0x92, 0x08, 0x4A, 0xB9, 0x92, 0x79, 0xA0, 0x00, 0x9B, 0x01, 0x61, 0x91, 0x01, 0x9F, 0xA8, 0x32, 0x51, 0x80, 0xAE, 0x81, 0x21, 0x19, 0x02, 0x1B, 0xCF, 0x12, 0x51, 0xA1, 0x88, 0xFB, 0x29, 0x22, 0xA3, 0x0D, 0xA3, 0x18, 0x2C, 0xC4, 0x11, 0x9D, 0x92, 0x61, 0x81, 0x99, 0xB9, 0x9B, 0x34, 0x48, 0x87, 0x0B, 0xA9, 0xA4, 0x3A, 0x89, 0xB1, 0x60, 0x83, 0x01, 0xD9, 0xAB, 0x08, 0x78, 0x7A, 0xB1, 0x01, 0x2B, 0xD8, 0x02, 0x0C, 0x82, 0x48, 0x00, 0x81, 0x9C, 0xB9, 0x28, 0x63, 0xC4, 0x49, 0x9A, 0xB2, 0x10, 0x1C, 0xB5, 0x5A, 0x80, 0x82, 0x88, 0xAD, 0x81, 0x49, 0x15, 0x0D, 0xA2, 0x00, 0x3B, 0xC9, 0x81, 0x31, 0x1B, 0x07, 0x09, 0xB9, 0x9A, 0x3A, 0x73, 0xD4, 0x48, 0x9A, 0xA2, 0x00, 0x2B, 0xA2, 0x6B, 0x91, 0x11, 0x89, 0xBC, 0x00, 0x29, 0x66, 0xAA, 0x95, 0x1A, 0x99, 0xA1, 0x21, 0x4D, 0xC2, 0x22, 0x0B, 0xC0, 0x88, 0x2A, 0x23, 0xE4, 0x31, 0x0E, 0xB2, 0x08, 0x29, 0x19, 0xB7, 0x40, 0x8A, 0xA1, 0x89, 0x19, 0x01, 0x87, 0x4D, 0xC8, 0x83, 0x3B, 0x8A, 0xA1, 0xA5, 0x32, 0x3E, 0xC0, 0x91, 0x2A, 0x0A, 0x94, 0x79, 0xB8, 0x95, 0x3B, 0x9A, 0x88, 0xA2, 0x04, 0x48, 0x2B, 0xD1, 0x90, 0x98, 0x39, 0x48, 0x79, 0xC9, 0xB7, 0x29, 0x8A, 0x29, 0x8A, 0x86, 0x91, 0x82, 0x2A, 0x0D, 0x8A, 0x92, 0x04, 0xD4, 0x30, 0x3F, 0x98, 0x10, 0xC9, 0xA3, 0x20, 0x02, 0x5B, 0x89, 0x89, 0x9A, 0x18, 0x00, 0x17, 0x3E, 0xB8, 0x84, 0x88, 0xD1, 0x80, 0x88, 0x33, 0x3A, 0xC2, 0x80, 0xAC, 0xA0, 0x18, 0x04, 0x74, 0xD9, 0x93, 0x2A, 0xB1, 0x28, 0x0F, 0x01, 0x68, 0x09, 0x80, 0x0A, 0x99, 0x90, 0x11, 0x38, 0x14, 0x1F, 0x98, 0x30, 0xA9, 0xC2, 0x0B, 0xA2, 0x64, 0x00, 0x09, 0x99, 0xB9, 0xA8, 0x82, 0x71, 0x20, 0xC5, 0x08, 0x1A, 0x00, 0x0A, 0xEA, 0x91, 0x32, 0x73, 0x89, 0xA0, 0x8A, 0x9A, 0xA1, 0x31, 0x78, 0x81, 0x94, 0x1E, 0x88, 0x01, 0x99, 0x8B, 0x8A, 0x35, 0x63, 0xB0, 0xB0, 0x0A, 0x2E, 0xA0, 0x10, 0x20, 0x04, 0x30, 0xCC, 0x1A, 0x80, 0x23, 0xAC, 0xE9, 0x11, 0x53, 0x28, 0xA0, 0x3B, 0xAF, 0xB1, 0x10, 0x11, 0x16, 0x81, 0xC2, 0x8E, 0xA0, 0x32, 0x80, 0xB1, 0x8D, 0x12, 0x71, 0x88, 0x88, 0xA8, 0x1C, 0xB9, 0x12, 0x70, 0x03, 0x98, 0x49, 0xAF, 0x80, 0x02, 0x12, 0xB0, 0x99, 0x3D, 0x20, 0x03, 0x19, 0x9B, 0xF9, 0xC1, 0x28, 0x49, 0x05, 0x91, 0x09, 0xE9, 0x9A, 0x41, 0x11, 0x84, 0xAA, 0xAB, 0x49, 0x51, 0x01, 0x98, 0xD8, 0x1A, 0xCA, 0x13, 0x05, 0x33, 0x9C, 0x0B, 0xE1, 0xA9, 0x15, 0x20, 0x28, 0xFB, 0x80, 0x18, 0x12, 0x38, 0x8A, 0xE4, 0x98, 0xA9, 0x58, 0x40, 0x10, 0xC0, 0x88, 0x1A, 0xC0, 0x19, 0x14, 0x10, 0x18, 0xAD, 0x19, 0x81, 0x97, 0x21, 0x0A, 0x8D, 0xB9, 0x02, 0x03, 0x27, 0x2B, 0xC9, 0x98, 0xA1, 0x92, 0x7D, 0x28, 0x88, 0xB8, 0xA0, 0x19, 0x15, 0xA0, 0x23, 0xC1, 0xCB, 0x1D, 0x09, 0x53, 0x23, 0x9B, 0x99, 0xC0, 0x99, 0xC4, 0x1B, 0x65, 0x80, 0x09, 0xA9, 0x99, 0x21, 0xA2, 0x43, 0x82, 0xDE, 0x09, 0x81, 0x51, 0x83, 0xC8, 0x98, 0x88, 0x3B, 0x81, 0x6A, 0x03, 0xF0, 0x90, 0x80, 0x88, 0x40, 0x20, 0x30, 0xEB, 0xF8, 0x88, 0x12, 0x14, 0x10, 0x9B, 0xBA, 0x00, 0x98, 0xD3, 0x52, 0x11, 0x09, 0x0C, 0x88, 0x2C, 0x09, 0x13, 0x97, 0xC9, 0x88, 0x39, 0x6A, 0x11, 0xE0, 0x91, 0x82, 0x89, 0x2C, 0xE0, 0x03, 0x41, 0x09, 0x9B, 0xC1, 0xC2, 0x82, 0x52, 0x09, 0x8B, 0xA8, 0xA1, 0x06, 0x00, 0x38, 0xA8, 0xCA, 0x3B, 0x78, 0x1A, 0x2C, 0xC3, 0x87, 0x98, 0x09, 0x0A, 0x08, 0x42, 0x81, 0xB9, 0x0A, 0x18, 0xB7, 0xA3, 0x10, 0x2E, 0x1A, 0x20, 0xC1, 0x08, 0x59, 0x38, 0xF0, 0x90, 0xA9, 0x42, 0x6B, 0x80, 0x19, 0xB8, 0xA2, 0x11, 0x8C, 0x12, 0x5E, 0x88, 0x90, 0x00, 0xC9, 0x97, 0x01, 0x1B, 0x19, 0x2A, 0x89, 0xC4, 0x02, 0x08, 0xA3, 0xA8, 0x10, 0xFA, 0x78, 0x1B, 0xA2, 0x01, 0x90, 0xB2, 0x12, 0x0F, 0x80, 0x58, 0x1B, 0x89, 0x91, 0x48, 0xA7, 0x08, 0x8B, 0x18, 0x29, 0x49, 0xF1, 0x11, 0x81, 0x91, 0xB8, 0x3B, 0x8B, 0x78, 0x19, 0x92, 0x93, 0xF0, 0xB2, 0x31, 0x4C, 0x1B, 0x9A, 0x08, 0xA5, 0x97, 0x92, 0x19, 0xAB, 0x39, 0x3D, 0x08, 0x13, 0xC5, 0xB3, 0x81, 0x8D, 0x1C, 0x38, 0x03, 0x80, 0xD3, 0xD3, 0x88, 0x18, 0x2A, 0x79, 0x89, 0xA8, 0x02, 0xB3, 0x96, 0xA0, 0x1E, 0x49, 0x19, 0x09, 0x90, 0x97, 0xA1, 0xA0, 0x88, 0x6B, 0x28, 0x08, 0x89, 0xD2, 0x81, 0xB2, 0x51, 0x0C, 0x20, 0x8D, 0x08, 0x10, 0x87, 0xA8, 0xB2, 0x90, 0x40, 0x1F, 0x00, 0x08, 0x82, 0x90, 0xB5, 0x9A, 0xA1, 0x40, 0x09, 0x5B, 0x88, 0x97, 0xB1, 0xA0, 0x92, 0x6B, 0x0B, 0x30, 0x39, 0x6B, 0x1C, 0x88, 0xD2, 0xA2, 0x10, 0x3D, 0x5B, 0x02, 0xC9, 0xA1, 0x88, 0x40, 0x28, 0xA8, 0xA0, 0x38, 0x5D, 0x1A, 0xE1, 0xA4, 0x01, 0xAB, 0x7A, 0x12, 0xA0, 0xBA, 0x80, 0x5A, 0x02, 0xA2, 0x88, 0xCA, 0x7A, 0x39, 0x8A, 0xA2, 0x85, 0xAB, 0x1A, 0x46, 0xC1, 0xAB, 0x11, 0x28, 0x3D, 0x17, 0xB0, 0xAB, 0x90, 0x29, 0x42, 0x03, 0x82, 0xDA, 0x9E, 0x61, 0x80, 0xA9, 0x08, 0x08, 0x11, 0x42, 0x43, 0xFC, 0x0A, 0x00, 0x08, 0x14, 0x80, 0x90, 0xBA, 0x69, 0x02, 0xCB, 0x19, 0xA0, 0x51, 0x04, 0x08, 0x91, 0xBF, 0x29, 0x81, 0x40, 0x84, 0x98, 0xB9, 0x29, 0x06, 0xBA, 0x08, 0xBA, 0x64, 0x93, 0x18, 0xA1, 0xBD, 0x00, 0x1B, 0x34, 0x09, 0x25, 0xDC, 0x30, 0x80, 0x90, 0xBC, 0x08, 0x60, 0x14, 0x89, 0xB1, 0x9A, 0xAA, 0x30, 0x18, 0x34, 0x42, 0xF9, 0x19, 0x22, 0xB9, 0xAE, 0x89, 0x43, 0x35, 0xA8, 0xA9, 0x88, 0xAB, 0x80, 0x00, 0x71, 0x03, 0xC2, 0x8B, 0x17, 0x9A, 0xEB, 0x18, 0x30, 0x16, 0x98, 0xA9, 0x10, 0xB8, 0x08, 0x89, 0x59, 0x33, 0x4B, 0x8F, 0x86, 0x98, 0xC9, 0x18, 0x20, 0x06, 0x98, 0x99, 0x10, 0xA0, 0x98, 0xB8, 0x42, 0x13, 0x78, 0x1F, 0x82, 0x2A, 0xAD, 0x10, 0x5A, 0x83, 0x88, 0x8B, 0x22, 0x9A, 0xA9, 0x8A, 0xA4, 0x64, 0x79, 0x3F, 0x80, 0x08, 0xBA, 0xA2, 0x21, 0x06, 0x90, 0x8A, 0x20, 0x89, 0x8A, 0xC9, 0x82, 0x64, 0x7C, 0x1C, 0xC3, 0x91, 0xA0, 0x28, 0x3B, 0x04, 0xB8, 0xB2, 0x48, 0x19, 0x0C, 0x98, 0xB1, 0x07, 0x60, 0x3F, 0xB0, 0x93, 0x89, 0x3A, 0x1B, 0x87, 0x00, 0xA9, 0x00, 0x92, 0x29, 0xBB, 0x18, 0x84, 0xD7, 0x04, 0x4F, 0xA0, 0xB1, 0x92, 0x4B, 0x00, 0xA3, 0x00, 0x1E, 0xA2, 0x82, 0x1B, 0x8B, 0x02, 0x07, 0x3E, 0xF1, 0x13, 0x0A, 0x0A, 0xD1, 0x21, 0x38, 0x0A, 0xE1, 0x10, 0x28, 0x9A, 0x91, 0x09, 0x40, 0x94, 0x0E, 0xC4, 0x30, 0x09, 0x9B, 0xB2, 0x41, 0x40, 0x99, 0xF2, 0x28, 0x29, 0xA9, 0x91, 0x19, 0x13, 0x94, 0xC4, 0x2F, 0xA1, 0xA3, 0x80, 0x1F, 0x00, 0x83, 0x11, 0x8D, 0xA8, 0x13, 0x2A, 0x9B, 0xA0, 0x44, 0x91, 0x21, 0xDE, 0x93, 0x31, 0x0B, 0xCB, 0x81, 0x44, 0x28, 0xA9, 0xDA, 0x31, 0x18, 0xB9, 0xC1, 0x50, 0x18, 0xA4, 0x81, 0x8F, 0xA1, 0x85, 0x28, 0x8D, 0x88, 0x84, 0x12, 0x1B, 0xDA, 0x11, 0x11, 0x9A, 0x8A, 0x93, 0x44, 0x1A, 0xB9, 0xA7, 0x2F, 0x20, 0xD1, 0x91, 0x09, 0x49, 0x01, 0xB1, 0x09, 0x2B, 0x11, 0xD2, 0xA9, 0x11, 0x30, 0x01, 0x38, 0x7E, 0x9C, 0xC1, 0x97, 0x00, 0x0A, 0x1A, 0x01, 0x84, 0xA1, 0x0C, 0x4A, 0x08, 0xE2, 0x91, 0x38, 0x3A, 0x92, 0xC8, 0xA2, 0xE5, 0x81, 0x6A, 0x2A, 0x98, 0xA0, 0x92, 0x02, 0x02, 0x0D, 0x1B, 0xB3, 0x95, 0x88, 0x2C, 0x28, 0x81, 0xA2, 0xB0, 0x69, 0x4C, 0x2E, 0x99, 0x84, 0xB3, 0xC0, 0x00, 0x49, 0x20, 0x8A, 0x1C, 0x98, 0x96, 0xB1, 0x88, 0x10, 0x41, 0x39, 0x8D, 0x90, 0x90, 0x79, 0xE9, 0x82, 0x84, 0x80, 0xB8, 0x89, 0x30, 0x03, 0xA0, 0xAA, 0x4A, 0x30, 0xA0, 0xAD, 0x38, 0x33, 0x43, 0xCC, 0xA9, 0x12, 0x1A, 0xA6, 0x9C, 0x14, 0x01, 0xA5, 0xAA, 0x99, 0x5A, 0x91, 0x30, 0x02, 0x13, 0xCF, 0x89, 0x1C, 0x05, 0x31, 0x80, 0xBC, 0xA0, 0xA0, 0x16, 0xA9, 0x31, 0x80, 0x33, 0xCA, 0xCE, 0x08, 0x03, 0x73, 0x98, 0x80, 0xB9, 0x8B, 0x92, 0x48, 0x63, 0x01, 0x99, 0xBC, 0x09, 0x6A, 0x92, 0xC9, 0x87, 0x10, 0xA0, 0xA8, 0xB9, 0x40, 0x29, 0x25, 0x18, 0xA9, 0xAE, 0x09, 0x38, 0x43, 0x83, 0x08, 0xBD, 0xC8, 0x92, 0x33, 0x2D, 0x3D, 0x01, 0x32, 0x9C, 0xCB, 0x8A, 0x05, 0x82, 0x84, 0x93, 0xE8, 0x8A, 0x0D, 0x21, 0x14, 0x93, 0x99, 0xCB, 0x0A, 0x38, 0x48, 0xB7, 0x19, 0x11, 0x00, 0xE0, 0x90, 0x8B, 0x83, 0x18, 0x37, 0x18, 0xE8, 0xB9, 0x1B, 0x31, 0x16, 0x82, 0x8A, 0xAB, 0xAA, 0x83, 0x50, 0xA7, 0xC0, 0x83, 0x10, 0x81, 0xB9, 0x8F, 0x28, 0x18, 0x07, 0x00, 0xA8, 0x9C, 0x99, 0x40, 0x33, 0x01, 0xA9, 0x8D, 0x98, 0xA8, 0x05, 0x09, 0x78, 0x10, 0x08, 0x8C, 0xAB, 0x08, 0x85, 0x31, 0x12, 0xC2, 0xF9, 0x0A, 0x2B, 0x41, 0x12, 0xA5, 0xB8, 0xB1, 0xAC, 0x23, 0x12, 0xBB, 0x15, 0x31, 0x20, 0xAE, 0xBC, 0x18, 0x22, 0x16, 0x12, 0xA8, 0xBD, 0xCA, 0x3A, 0x73, 0x21, 0x91, 0xB9, 0xAC, 0xA0, 0x84, 0xA7, 0x98, 0x95, 0x02, 0x88, 0x99, 0x8E, 0x10, 0x50, 0xA0, 0x83, 0xA0, 0xBA, 0x99, 0x1C, 0x54, 0x21, 0x80, 0xE8, 0xA8, 0xA0, 0x42, 0x99, 0x5A, 0x20, 0x21, 0xBA, 0xEA, 0x8A, 0x11, 0x73, 0xB2, 0xD4, 0xD2, 0x91, 0x91, 0x10, 0x29, 0x39, 0x38, 0x09, 0xAA, 0x0F, 0x29, 0x81, 0x2E, 0x03, 0x11, 0x88, 0xEB, 0x8B, 0x20, 0x71, 0x11, 0x88, 0x8D, 0x89, 0x19, 0x02, 0x82, 0x81, 0x98, 0x01, 0x10, 0x8A, 0x8F, 0xB9, 0x13, 0x46, 0xDB, 0x30, 0x4A, 0x30, 0x9B, 0xEB, 0x99, 0x21, 0x26, 0x82, 0x99, 0xCA, 0x0B, 0x38, 0x38, 0x28, 0x83, 0x02, 0x10, 0xC9, 0x9E, 0x8C, 0x19, 0x54, 0x4C, 0x7C, 0x09, 0x0A, 0x88, 0x81, 0x93, 0xC2, 0x0B, 0x08, 0x20, 0x52, 0x10, 0x1A, 0x8F, 0x0C, 0x29, 0x12, 0x13, 0xB2, 0xE9, 0x88, 0xB0, 0x92, 0x33, 0x92, 0x3A, 0x0D, 0x6D, 0x09, 0x10, 0xB8, 0x90, 0x89, 0x10, 0x82, 0x61, 0x4B, 0x29, 0x89, 0xC0, 0x2F, 0x4B, 0x3A, 0x49, 0x1D, 0x81, 0x08, 0x01, 0x1A, 0xCA, 0x1E, 0x62, 0xA1, 0xC1, 0xF2, 0x00, 0x81, 0x01, 0x10, 0x80, 0x0A, 0xDB, 0x08, 0x30, 0x22, 0x18, 0xAB, 0x3A, 0x7B, 0x48, 0x8B, 0x9B, 0x4C, 0x81, 0x12, 0x08, 0x3D, 0x4B, 0x90, 0xD9, 0xD5, 0x92, 0x91, 0x94, 0x80, 0x09, 0xD6, 0x28, 0x01, 0x8B, 0x1B, 0x32, 0x68, 0x89, 0x0D, 0x38, 0x2B, 0x5C, 0x3A, 0x0A, 0x09, 0xE3, 0x01, 0xA0, 0xA2, 0x92, 0x84, 0x4C, 0x0E, 0x20, 0x08, 0x90, 0x09, 0x50, 0x8E, 0x11, 0x80, 0x08, 0x90, 0xA0, 0x28, 0xA1, 0x09};
+
+#define YOULOSE_FORMAT AUDIO_FORMAT_ADPCM4  ///< Storage format of youLose
+#define YOULOSE_NUM_SAMPLES 6610  ///< Number of samples in youLose
+#define YOULOSE_SAMPLE_RATE_HZ 6510  ///< Sample rate of youLose in HZ
+#define YOULOSE_LOOP_START 0  ///< Sample of youLose that audio_mode_loop goes back to
 /** @hideinitializer The goodbye noise to play once after a failure */
-const uint8_t youLose[] = {0x7F, 0x7F, 0x7E, 0x7E, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x80, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x81, 0x7E, 0x80, 0x7F, 0x80, 0x7D, 0x7F, 0x80, 0x7E, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x81, 0x80, 0x81, 0x7F, 0x81, 0x7C, 0x7D, 0x78, 0x81, 0x76, 0x89, 0x7E, 0x93, 0x99, 0x7F, 0xAC, 0x88, 0x76, 0x91, 0x68, 0x4B, 0x72, 0x44, 0x52, 0x71, 0x6C, 0x6E, 0x96, 0x95, 0x7A, 0xB5, 0x90, 0x8F, 0xAF, 0x99, 0x90, 0xB0, 0x96, 0x88, 0xA7, 0x78, 0x70, 0x80, 0x5B, 0x52, 0x75, 0x4C, 0x4E, 0x6E, 0x57, 0x56, 0x71, 0x66, 0x65, 0x8B, 0x75, 0x81, 0x9C, 0x88, 0x8B, 0xAD, 0x9B, 0xB7, 0xB8, 0xBE, 0xAE, 0xB7, 0xA0, 0x8E, 0x93, 0x67, 0x70, 0x58, 0x56, 0x49, 0x50, 0x37, 0x62, 0x2D, 0x5D, 0x65, 0x46, 0x7F, 0x73, 0x7A, 0x84, 0xAF, 0x7E, 0xB6, 0xB3, 0xA1, 0xC0, 0xBE, 0xA7, 0xB9, 0xB5, 0x91, 0xA5, 0x8F, 0x6E, 0x78, 0x67, 0x48, 0x61, 0x4C, 0x45, 0x4E, 0x57, 0x3B, 0x5C, 0x5F, 0x49, 0x76, 0x6B, 0x6C, 0x8A, 0x8D, 0x8F, 0xAA, 0xAF, 0xB3, 0xC8, 0xD0, 0xB7, 0xC8, 0xC2, 0x97, 0xA4, 0x88, 0x65, 0x68, 0x54, 0x3E, 0x50, 0x41, 0x3C, 0x4F, 0x4C, 0x59, 0x54, 0x85, 0x67, 0x81, 0x9E, 0x85, 0x9D, 0x9F, 0xA0, 0x95, 0xAC, 0x98, 0x9F, 0xA2, 0xA1, 0x94, 0x9E, 0x91, 0x8A, 0x81, 0x80, 0x6A, 0x6C, 0x70, 0x5A, 0x64, 0x6E, 0x59, 0x54, 0x82, 0x3B, 0x78, 0x64, 0x5E, 0x76, 0x7A, 0x79, 0x93, 0xA4, 0x99, 0xB9, 0xB2, 0xB1, 0xB2, 0xB2, 0x8E, 0xA4, 0x7A, 0x75, 0x6C, 0x74, 0x45, 0x7D, 0x4D, 0x5E, 0x6C, 0x5A, 0x64, 0x71, 0x81, 0x62, 0xAD, 0x65, 0xB0, 0x70, 0x9E, 0x89, 0x7C, 0x8E, 0x86, 0x89, 0x6F, 0xA5, 0x75, 0x89, 0x9C, 0x79, 0x89, 0x93, 0x71, 0x8D, 0x77, 0x87, 0x74, 0x8F, 0x6B, 0x7C, 0x83, 0x5C, 0x7C, 0x5C, 0x71, 0x5E, 0x6E, 0x64, 0x72, 0x8E, 0x76, 0xB0, 0x92, 0xAA, 0xAF, 0x93, 0x9A, 0x8D, 0x76, 0x88, 0x7D, 0x78, 0x84, 0x74, 0x80, 0x6B, 0x6D, 0x6E, 0x6D, 0x5F, 0x85, 0x69, 0x80, 0x8B, 0x88, 0x7E, 0x94, 0x89, 0x7F, 0x92, 0x79, 0x72, 0x98, 0x6E, 0x74, 0x8F, 0x6F, 0x8A, 0x7B, 0x8A, 0x88, 0x90, 0x78, 0x95, 0x8D, 0x7E, 0x96, 0x7E, 0x7F, 0x96, 0x53, 0x95, 0x67, 0x63, 0x61, 0x6C, 0x61, 0x55, 0x8C, 0x64, 0x9A, 0x81, 0xA5, 0x97, 0xA0, 0x9A, 0x97, 0xA1, 0x84, 0x92, 0x88, 0x78, 0x81, 0x5C, 0x92, 0x4C, 0x79, 0x60, 0x78, 0x6E, 0x6F, 0x97, 0x61, 0x9C, 0x6C, 0xA7, 0x78, 0x9C, 0x7C, 0x94, 0x83, 0x7B, 0x83, 0x7B, 0x6B, 0x72, 0x73, 0x76, 0x6E, 0x83, 0x7B, 0x7F, 0x94, 0x6E, 0xAF, 0x74, 0xAB, 0x7B, 0xA5, 0x7E, 0x82, 0x88, 0x73, 0x70, 0x61, 0x6D, 0x5D, 0x6B, 0x53, 0x8C, 0x6B, 0x84, 0x86, 0xA8, 0x83, 0xA2, 0x9E, 0x95, 0x9F, 0x6D, 0xA5, 0x6C, 0x7A, 0x72, 0x79, 0x61, 0x7D, 0x68, 0x69, 0x94, 0x59, 0x94, 0x85, 0x91, 0x73, 0xA9, 0x80, 0x7F, 0x93, 0x80, 0x80, 0x7D, 0x82, 0x5D, 0x94, 0x65, 0x6D, 0x7D, 0x79, 0x64, 0xAD, 0x44, 0x9A, 0x97, 0x51, 0xCB, 0x67, 0x96, 0x9C, 0x96, 0x7C, 0x95, 0x7A, 0x66, 0x8A, 0x6C, 0x4F, 0x81, 0x5D, 0x5C, 0x8F, 0x67, 0x77, 0x9E, 0x8F, 0x89, 0xBA, 0x71, 0xB1, 0x88, 0x96, 0x6A, 0x8B, 0x74, 0x5D, 0x99, 0x47, 0x87, 0x66, 0x74, 0x87, 0x81, 0x67, 0xBF, 0x58, 0xA2, 0x8E, 0x74, 0x97, 0x8A, 0x8F, 0x5A, 0xA6, 0x54, 0x79, 0x84, 0x61, 0x60, 0x91, 0x53, 0x8F, 0x73, 0x78, 0x8E, 0x8A, 0x95, 0x8C, 0xA3, 0x94, 0x9B, 0x9B, 0x91, 0x79, 0x8B, 0x63, 0x75, 0x5E, 0x58, 0x5B, 0x64, 0x52, 0x8D, 0x55, 0x93, 0x99, 0x90, 0xA2, 0xA0, 0xAA, 0x7A, 0xBE, 0x7B, 0x6B, 0x97, 0x76, 0x54, 0x92, 0x5C, 0x5A, 0x86, 0x62, 0x7F, 0x82, 0x6D, 0xB8, 0x5D, 0xB0, 0x86, 0x73, 0xAB, 0x78, 0x96, 0x69, 0x96, 0x5A, 0x7F, 0x71, 0x5E, 0x67, 0x84, 0x62, 0x7C, 0xA2, 0x47, 0xA5, 0xAA, 0x3C, 0xD3, 0x8C, 0x57, 0xE5, 0x73, 0x69, 0xB8, 0x68, 0x4D, 0xA5, 0x45, 0x53, 0x86, 0x40, 0x5E, 0x9C, 0x60, 0x82, 0xB6, 0x88, 0x92, 0xCB, 0x8D, 0x8B, 0xC4, 0x53, 0x8B, 0x82, 0x4E, 0x75, 0x66, 0x64, 0x53, 0x74, 0x90, 0x3A, 0xC2, 0x82, 0x5B, 0xDD, 0x68, 0x93, 0xBB, 0x85, 0x7A, 0xA5, 0x66, 0x68, 0x7D, 0x69, 0x43, 0x87, 0x57, 0x59, 0x8E, 0x82, 0x74, 0x7B, 0xCE, 0x47, 0xC2, 0xBB, 0x64, 0xC4, 0xAD, 0x47, 0xBB, 0x73, 0x39, 0x94, 0x47, 0x3C, 0x71, 0x59, 0x3C, 0xA8, 0x59, 0x82, 0xB0, 0x9C, 0x91, 0xD3, 0x9F, 0xA5, 0xB3, 0x81, 0x9C, 0x5A, 0x84, 0x4F, 0x5C, 0x65, 0x56, 0x5F, 0x69, 0x7D, 0x55, 0xA6, 0x8E, 0x69, 0xC9, 0x83, 0x8C, 0xB7, 0x8C, 0x7B, 0xAA, 0x6F, 0x62, 0x82, 0x55, 0x5A, 0x71, 0x72, 0x48, 0x95, 0x7A, 0x73, 0x7E, 0xB8, 0x6A, 0x94, 0xCD, 0x6A, 0xB5, 0xB5, 0x78, 0x7A, 0xAB, 0x43, 0x6E, 0x74, 0x47, 0x42, 0x77, 0x4D, 0x43, 0xA9, 0x6F, 0x85, 0xBF, 0x8F, 0xA8, 0xCF, 0x75, 0xD9, 0x8D, 0x64, 0xBA, 0x4D, 0x54, 0x87, 0x3E, 0x52, 0x81, 0x39, 0x6C, 0x84, 0x5B, 0x94, 0x94, 0x8E, 0xAD, 0xA5, 0x9C, 0xA8, 0xAD, 0x88, 0x93, 0x92, 0x6F, 0x65, 0x76, 0x4F, 0x57, 0x5D, 0x57, 0x62, 0x6B, 0x75, 0x80, 0x79, 0xA2, 0x8E, 0x72, 0xE3, 0x6F, 0x94, 0xD5, 0x7E, 0x7A, 0xC3, 0x63, 0x51, 0xAF, 0x38, 0x56, 0x79, 0x49, 0x4B, 0x87, 0x5B, 0x73, 0xA5, 0x93, 0xA2, 0x93, 0xD0, 0x8C, 0x7C, 0xDE, 0x5C, 0x5A, 0xC0, 0x3E, 0x3F, 0xAC, 0x29, 0x4B, 0xA0, 0x3B, 0x5F, 0xA7, 0x71, 0x7C, 0xBA, 0x97, 0xAE, 0xA5, 0xB2, 0xAA, 0x88, 0xA2, 0x93, 0x55, 0x91, 0x77, 0x2C, 0x83, 0x4D, 0x31, 0x74, 0x60, 0x3E, 0xA4, 0x74, 0x71, 0xA4, 0x98, 0x93, 0x8D, 0xC5, 0x92, 0x9A, 0xB1, 0xB1, 0x6C, 0xA2, 0x95, 0x43, 0x7C, 0x73, 0x3A, 0x4A, 0x79, 0x3E, 0x5C, 0x8D, 0x7A, 0x76, 0xB8, 0x98, 0x96, 0xB5, 0xAF, 0x85, 0x94, 0xB7, 0x51, 0x7D, 0x89, 0x48, 0x53, 0x71, 0x41, 0x56, 0x73, 0x5E, 0x6C, 0x8C, 0x97, 0x90, 0xB7, 0xAD, 0xA4, 0xB9, 0xAF, 0x94, 0xA3, 0x90, 0x72, 0x71, 0x6B, 0x5A, 0x50, 0x52, 0x5B, 0x48, 0x4B, 0x67, 0x6A, 0x6A, 0x82, 0x9E, 0x8F, 0x93, 0xAD, 0xA8, 0x7C, 0xD2, 0x91, 0x80, 0xD6, 0x84, 0x6C, 0xAD, 0x82, 0x3B, 0x91, 0x4E, 0x3F, 0x65, 0x49, 0x4E, 0x67, 0x5E, 0x7D, 0xA2, 0x7E, 0xB1, 0xB7, 0x9C, 0xB4, 0xB5, 0x7F, 0x96, 0xB6, 0x49, 0x71, 0xAA, 0x26, 0x46, 0x86, 0x44, 0x3A, 0x7D, 0x71, 0x78, 0x84, 0x8D, 0xBA, 0x90, 0x9C, 0xCF, 0x99, 0x8F, 0xBB, 0x92, 0x7A, 0x81, 0x73, 0x6E, 0x5A, 0x55, 0x75, 0x49, 0x4C, 0x70, 0x5F, 0x50, 0x80, 0x95, 0x62, 0xA0, 0xA2, 0x7F, 0xA9, 0xA0, 0x94, 0x8A, 0xB2, 0x92, 0x82, 0xB4, 0x92, 0x80, 0x83, 0x8F, 0x64, 0x6D, 0x51, 0x58, 0x56, 0x43, 0x56, 0x54, 0x70, 0x6B, 0x97, 0x93, 0xAA, 0xAA, 0xB2, 0xB9, 0xA1, 0x9D, 0x97, 0x9B, 0x72, 0x72, 0x72, 0x60, 0x57, 0x51, 0x51, 0x62, 0x52, 0x63, 0x83, 0x7C, 0x92, 0xA4, 0x9F, 0xA5, 0xAD, 0x9C, 0xAE, 0x94, 0x8E, 0x97, 0x7A, 0x72, 0x63, 0x64, 0x65, 0x55, 0x5D, 0x6F, 0x5C, 0x66, 0x7D, 0x6A, 0x72, 0x8B, 0x88, 0x90, 0x90, 0xA9, 0x98, 0x8D, 0xA1, 0x9D, 0x8A, 0x79, 0x9C, 0x85, 0x88, 0x8E, 0x7E, 0x83, 0x7D, 0x68, 0x71, 0x65, 0x51, 0x58, 0x50, 0x5C, 0x58, 0x64, 0x81, 0x8F, 0x90, 0xA8, 0xBA, 0xBB, 0x9C, 0xAE, 0xBD, 0x8F, 0x78, 0x8C, 0x80, 0x62, 0x5F, 0x4E, 0x5C, 0x52, 0x50, 0x54, 0x61, 0x66, 0x7A, 0x8A, 0x95, 0xAA, 0xB0, 0xB6, 0xA2, 0xA6, 0xA6, 0x99, 0x88, 0x77, 0x70, 0x73, 0x57, 0x53, 0x68, 0x61, 0x5F, 0x71, 0x77, 0x74, 0x91, 0x82, 0x8F, 0x90, 0x7B, 0x93, 0x8C, 0x79, 0x84, 0x92, 0x85, 0x8E, 0x77, 0x7B, 0x97, 0x89, 0x79, 0x8A, 0x95, 0x83, 0x8F, 0x86, 0x88, 0x86, 0x7C, 0x78, 0x6D, 0x55, 0x5B, 0x5F, 0x4C, 0x5F, 0x5B, 0x6E, 0x88, 0x8E, 0x98, 0xA1, 0xB6, 0xB9, 0xAB, 0xB1, 0xA6, 0x9E, 0x90, 0x76, 0x78, 0x69, 0x62, 0x5E, 0x4F, 0x52, 0x53, 0x4E, 0x52, 0x53, 0x72, 0x79, 0x96, 0xAA, 0x9F, 0xB5, 0xBF, 0xAF, 0xA6, 0x9F, 0x91, 0x93, 0x78, 0x72, 0x62, 0x56, 0x56, 0x56, 0x55, 0x63, 0x76, 0x76, 0x8F, 0x89, 0x8D, 0xA0, 0x8D, 0x87, 0x9C, 0x82, 0x87, 0x8C, 0x65, 0x74, 0x84, 0x73, 0x78, 0x7E, 0x78, 0x89, 0x92, 0x87, 0x87, 0x90, 0x88, 0x99, 0x8D, 0x82, 0x8E, 0x77, 0x7C, 0x73, 0x5A, 0x60, 0x5C, 0x50, 0x62, 0x67, 0x65, 0x80, 0x88, 0x91, 0x9C, 0xAA, 0xAF, 0xB6, 0xAF, 0xA0, 0xA8, 0x96, 0x88, 0x7B, 0x69, 0x5A, 0x6A, 0x5E, 0x4D, 0x4B, 0x46, 0x47, 0x5F, 0x6B, 0x64, 0x92, 0xA1, 0xA7, 0xB9, 0xB6, 0xA9, 0xB3, 0xA3, 0xA4, 0x90, 0x81, 0x6B, 0x69, 0x6B, 0x4D, 0x61, 0x4D, 0x5B, 0x6A, 0x73, 0x75, 0x93, 0x8D, 0x8E, 0xA8, 0x93, 0x9D, 0x93, 0x82, 0x84, 0x82, 0x61, 0x6D, 0x70, 0x56, 0x79, 0x7D, 0x75, 0x95, 0x97, 0x8A, 0x94, 0xAB, 0x92, 0x8D, 0x8C, 0x73, 0x83, 0x8E, 0x7D, 0x7C, 0x75, 0x60, 0x6A, 0x5F, 0x5B, 0x5C, 0x59, 0x63, 0x73, 0x7E, 0x8C, 0x93, 0x8F, 0xA4, 0xA4, 0xAD, 0xAE, 0xA4, 0xA3, 0xA4, 0x93, 0x90, 0x83, 0x5C, 0x66, 0x6B, 0x60, 0x65, 0x56, 0x3F, 0x50, 0x4B, 0x5A, 0x6B, 0x76, 0x89, 0x91, 0xAA, 0xB1, 0xB6, 0xB4, 0xB7, 0xA6, 0xA7, 0x9D, 0x7E, 0x83, 0x65, 0x5C, 0x5C, 0x51, 0x4B, 0x55, 0x68, 0x70, 0x85, 0x81, 0x81, 0x82, 0x8B, 0x9C, 0xA3, 0x9E, 0x97, 0x92, 0x87, 0x7F, 0x7A, 0x6D, 0x6D, 0x67, 0x67, 0x74, 0x79, 0x79, 0x86, 0x8E, 0x7C, 0x94, 0x8F, 0x90, 0x93, 0x87, 0x78, 0x7B, 0x81, 0x83, 0x8F, 0x91, 0x8E, 0x6E, 0x7C, 0x6E, 0x61, 0x5C, 0x6C, 0x5B, 0x53, 0x77, 0x68, 0x7E, 0x8E, 0x86, 0x92, 0xAE, 0xA0, 0xB8, 0xBB, 0xA6, 0xAE, 0x94, 0x82, 0x83, 0x74, 0x6E, 0x74, 0x57, 0x4C, 0x4A, 0x3E, 0x45, 0x51, 0x57, 0x66, 0x74, 0x88, 0xA1, 0xB4, 0xB9, 0xC0, 0xC0, 0xB4, 0xA6, 0x9D, 0x8B, 0x74, 0x73, 0x65, 0x58, 0x4E, 0x52, 0x53, 0x63, 0x78, 0x73, 0x84, 0x88, 0x7B, 0x91, 0xA3, 0x99, 0xA5, 0x9B, 0x8C, 0x81, 0x7D, 0x79, 0x6F, 0x72, 0x60, 0x67, 0x71, 0x6F, 0x76, 0x8F, 0x8A, 0x90, 0x96, 0x99, 0x95, 0x81, 0x89, 0x76, 0x76, 0x89, 0x8F, 0x8D, 0x94, 0x7D, 0x71, 0x69, 0x5A, 0x60, 0x62, 0x62, 0x60, 0x66, 0x69, 0x7D, 0x89, 0x96, 0xA3, 0x9B, 0xA2, 0xAC, 0xB3, 0xB6, 0xAC, 0xA7, 0x87, 0x67, 0x6B, 0x65, 0x62, 0x76, 0x5E, 0x4E, 0x4E, 0x3E, 0x45, 0x58, 0x64, 0x71, 0x90, 0x8D, 0xA9, 0xB7, 0xB6, 0xC1, 0xB4, 0xA6, 0x9C, 0x92, 0x7F, 0x81, 0x6F, 0x64, 0x53, 0x55, 0x53, 0x5A, 0x70, 0x78, 0x84, 0x85, 0x81, 0x7D, 0x8D, 0x88, 0x9A, 0xA3, 0x95, 0x9A, 0x8E, 0x74, 0x7A, 0x77, 0x66, 0x72, 0x65, 0x68, 0x6E, 0x7C, 0x87, 0x90, 0x93, 0x94, 0x99, 0x88, 0x96, 0x8B, 0x7E, 0x7D, 0x6F, 0x6B, 0x7B, 0x77, 0x85, 0x92, 0x7F, 0x7F, 0x6C, 0x6D, 0x69, 0x6E, 0x73, 0x6D, 0x6C, 0x6F, 0x79, 0x83, 0x94, 0x96, 0x9C, 0x90, 0x99, 0xA1, 0xA2, 0xAB, 0xA7, 0x93, 0x85, 0x75, 0x6E, 0x74, 0x76, 0x77, 0x62, 0x55, 0x3E, 0x3C, 0x45, 0x55, 0x5F, 0x81, 0x8B, 0x8F, 0xAD, 0xA8, 0xBB, 0xBF, 0xB6, 0xAC, 0xA3, 0x91, 0x87, 0x7E, 0x71, 0x63, 0x53, 0x51, 0x51, 0x5A, 0x74, 0x75, 0x86, 0x7F, 0x70, 0x77, 0x7B, 0x94, 0x9E, 0xA7, 0xA8, 0x94, 0x89, 0x86, 0x6B, 0x7D, 0x6B, 0x69, 0x6A, 0x62, 0x6D, 0x74, 0x80, 0x8F, 0x94, 0x8E, 0x9A, 0x88, 0x8C, 0x8A, 0x7C, 0x83, 0x88, 0x84, 0x95, 0x8E, 0x8A, 0x7D, 0x70, 0x65, 0x5A, 0x55, 0x5C, 0x5A, 0x57, 0x6F, 0x6E, 0x85, 0x93, 0x95, 0xA1, 0xB2, 0xAA, 0xB0, 0xBD, 0xAE, 0x9E, 0x95, 0x83, 0x72, 0x66, 0x66, 0x6B, 0x60, 0x57, 0x4B, 0x43, 0x41, 0x43, 0x59, 0x76, 0x7F, 0x94, 0xA8, 0xAE, 0xAD, 0xB7, 0xB7, 0xB0, 0xA3, 0x90, 0x90, 0x7D, 0x69, 0x71, 0x6E, 0x55, 0x57, 0x5C, 0x58, 0x68, 0x70, 0x81, 0x91, 0x89, 0x91, 0x9A, 0x98, 0x91, 0x99, 0x95, 0x84, 0x7A, 0x72, 0x71, 0x69, 0x63, 0x71, 0x6F, 0x6E, 0x7B, 0x86, 0x91, 0x92, 0x98, 0x96, 0x8E, 0x80, 0x80, 0x8A, 0x8B, 0x92, 0xA0, 0x9C, 0x83, 0x78, 0x66, 0x59, 0x4E, 0x4D, 0x55, 0x52, 0x53, 0x68, 0x6E, 0x80, 0x99, 0x9F, 0xB0, 0xBD, 0xB7, 0xBC, 0xCB, 0xAC, 0x9E, 0x97, 0x78, 0x5C, 0x63, 0x61, 0x5B, 0x5B, 0x4D, 0x48, 0x3E, 0x3B, 0x49, 0x67, 0x76, 0x8E, 0xA7, 0xB1, 0xAD, 0xB2, 0xBA, 0xB4, 0xA9, 0xA6, 0x94, 0x86, 0x72, 0x68, 0x6C, 0x62, 0x56, 0x5E, 0x5E, 0x52, 0x6B, 0x70, 0x84, 0x89, 0x95, 0x92, 0x9A, 0x96, 0x8B, 0x9B, 0x89, 0x8D, 0x88, 0x6F, 0x6B, 0x73, 0x6A, 0x6C, 0x6E, 0x74, 0x79, 0x86, 0x8F, 0x8E, 0x90, 0x95, 0x8F, 0x8B, 0x86, 0x89, 0x92, 0x93, 0x93, 0x8C, 0x88, 0x6A, 0x69, 0x5A, 0x47, 0x52, 0x4D, 0x56, 0x68, 0x6D, 0x7C, 0x90, 0x97, 0xA1, 0xA4, 0xB3, 0xB4, 0xBD, 0xC1, 0xA4, 0x9F, 0x84, 0x6B, 0x73, 0x5E, 0x64, 0x6B, 0x58, 0x57, 0x4A, 0x42, 0x4D, 0x58, 0x67, 0x77, 0x81, 0x8C, 0x99, 0xA5, 0xA1, 0xAD, 0xB3, 0xA6, 0xB3, 0x98, 0x8F, 0x94, 0x7D, 0x7F, 0x78, 0x65, 0x61, 0x60, 0x5B, 0x61, 0x5F, 0x6F, 0x76, 0x86, 0x82, 0x82, 0x8B, 0x80, 0x91, 0x8B, 0x82, 0x86, 0x89, 0x80, 0x80, 0x79, 0x7F, 0x78, 0x87, 0x8B, 0x81, 0x95, 0x87, 0x88, 0x8B, 0x75, 0x7B, 0x87, 0x84, 0x8D, 0x8B, 0x91, 0x8C, 0x89, 0x7A, 0x61, 0x5F, 0x4F, 0x55, 0x5C, 0x58, 0x68, 0x78, 0x7B, 0x89, 0x8A, 0x8A, 0xA6, 0xA5, 0xB5, 0xBB, 0xB3, 0xB1, 0xA1, 0x86, 0x7A, 0x71, 0x61, 0x75, 0x6E, 0x6A, 0x5F, 0x55, 0x44, 0x43, 0x4E, 0x59, 0x69, 0x80, 0x8F, 0x8F, 0xA0, 0x9D, 0xA6, 0xA7, 0xA8, 0xAB, 0xA7, 0xA2, 0x99, 0x8C, 0x81, 0x71, 0x67, 0x69, 0x5E, 0x5D, 0x64, 0x65, 0x63, 0x6E, 0x78, 0x74, 0x7C, 0x87, 0x83, 0x88, 0x99, 0x8E, 0x8D, 0x8F, 0x80, 0x7F, 0x89, 0x86, 0x7D, 0x8A, 0x7F, 0x79, 0x7E, 0x84, 0x7E, 0x82, 0x87, 0x74, 0x7A, 0x82, 0x80, 0x8E, 0x9C, 0x96, 0x9E, 0x90, 0x80, 0x6E, 0x5B, 0x4F, 0x4E, 0x54, 0x59, 0x62, 0x67, 0x71, 0x71, 0x85, 0x99, 0xA0, 0xB2, 0xBE, 0xBD, 0xBB, 0xB8, 0x9E, 0x90, 0x80, 0x60, 0x69, 0x65, 0x6A, 0x69, 0x64, 0x5A, 0x48, 0x4F, 0x4A, 0x5B, 0x6B, 0x7D, 0x8F, 0x92, 0x91, 0x9B, 0x98, 0x9F, 0xA7, 0x99, 0xA7, 0xA2, 0x99, 0x94, 0x93, 0x79, 0x70, 0x7E, 0x63, 0x61, 0x6B, 0x5D, 0x64, 0x6D, 0x6F, 0x6B, 0x76, 0x7C, 0x74, 0x8E, 0x94, 0x91, 0x99, 0x9B, 0x83, 0x88, 0x8B, 0x80, 0x81, 0x7E, 0x77, 0x73, 0x78, 0x69, 0x7B, 0x83, 0x7D, 0x88, 0x87, 0x81, 0x7F, 0x87, 0x9A, 0x99, 0xA2, 0xA4, 0x9E, 0x87, 0x6E, 0x62, 0x4C, 0x46, 0x48, 0x4E, 0x53, 0x5D, 0x65, 0x7B, 0x84, 0x91, 0xA3, 0xB2, 0xBD, 0xC0, 0xC5, 0xBC, 0xAB, 0x93, 0x85, 0x70, 0x64, 0x68, 0x6B, 0x6A, 0x62, 0x56, 0x51, 0x49, 0x42, 0x53, 0x60, 0x6E, 0x84, 0x91, 0x97, 0x96, 0xA0, 0xA3, 0xA5, 0xAB, 0xA6, 0xA6, 0x9E, 0x95, 0x8E, 0x83, 0x7A, 0x70, 0x66, 0x67, 0x60, 0x5B, 0x69, 0x63, 0x66, 0x71, 0x70, 0x76, 0x80, 0x89, 0x93, 0x9D, 0x99, 0x8F, 0x99, 0x85, 0x7C, 0x8B, 0x80, 0x7A, 0x78, 0x72, 0x6F, 0x73, 0x76, 0x83, 0x84, 0x85, 0x80, 0x84, 0x87, 0x84, 0x9C, 0xA5, 0xA5, 0xA3, 0x9B, 0x85, 0x67, 0x51, 0x4A, 0x43, 0x43, 0x4B, 0x5B, 0x63, 0x6A, 0x7E, 0x85, 0x95, 0xB1, 0xB6, 0xC9, 0xCB, 0xB5, 0xB3, 0x9F, 0x85, 0x80, 0x74, 0x6D, 0x73, 0x65, 0x5F, 0x5A, 0x4C, 0x45, 0x48, 0x4B, 0x5A, 0x6D, 0x7B, 0x8F, 0x95, 0x9D, 0xA5, 0xA3, 0xA4, 0xA7, 0xA4, 0xA2, 0x9E, 0x91, 0x88, 0x85, 0x74, 0x73, 0x6E, 0x61, 0x67, 0x63, 0x63, 0x69, 0x68, 0x7C, 0x7F, 0x7F, 0x90, 0x84, 0x89, 0x90, 0x89, 0x8C, 0x88, 0x87, 0x82, 0x7D, 0x78, 0x71, 0x74, 0x73, 0x7B, 0x87, 0x88, 0x89, 0x8A, 0x83, 0x83, 0x84, 0x8F, 0xA1, 0x9E, 0xA8, 0x9A, 0x89, 0x78, 0x5E, 0x4D, 0x48, 0x48, 0x46, 0x53, 0x5F, 0x60, 0x66, 0x82, 0x90, 0xA0, 0xB7, 0xC6, 0xCB, 0xC5, 0xBA, 0xA1, 0x8E, 0x8C, 0x77, 0x78, 0x7C, 0x65, 0x60, 0x58, 0x45, 0x42, 0x48, 0x4A, 0x53, 0x64, 0x73, 0x7A, 0x94, 0x9C, 0xA3, 0xAB, 0xA8, 0xAE, 0xB0, 0xA6, 0xA3, 0x9B, 0x8F, 0x80, 0x72, 0x6A, 0x5E, 0x61, 0x5E, 0x65, 0x63, 0x64, 0x75, 0x78, 0x6F, 0x90, 0x82, 0x83, 0x94, 0x85, 0x93, 0x89, 0x91, 0x89, 0x7C, 0x7E, 0x6F, 0x70, 0x7F, 0x7B, 0x84, 0x84, 0x86, 0x8C, 0x7F, 0x83, 0x90, 0x97, 0x9D, 0xA1, 0xAC, 0x98, 0x7B, 0x6D, 0x52, 0x45, 0x41, 0x46, 0x4F, 0x53, 0x58, 0x6B, 0x6C, 0x79, 0x95, 0xAE, 0xC1, 0xC6, 0xCF, 0xC6, 0xB2, 0xA3, 0x9A, 0x8F, 0x7E, 0x76, 0x74, 0x60, 0x4E, 0x49, 0x45, 0x3F, 0x41, 0x4E, 0x5E, 0x66, 0x73, 0x8B, 0x94, 0x9D, 0xA6, 0xAE, 0xB1, 0xAA, 0xAB, 0xA8, 0x9E, 0x91, 0x81, 0x78, 0x6D, 0x5F, 0x67, 0x6F, 0x70, 0x77, 0x7C, 0x7C, 0x6D, 0x6B, 0x70, 0x70, 0x79, 0x80, 0x85, 0x83, 0x7A, 0x74, 0x77, 0x77, 0x82, 0x8D, 0x98, 0x92, 0x8A, 0x8D, 0x8A, 0x88, 0x8B, 0x9A, 0x99, 0x98, 0x99, 0x9B, 0x8D, 0x80, 0x6E, 0x59, 0x4C, 0x3E, 0x43, 0x50, 0x56, 0x5D, 0x72, 0x73, 0x73, 0x8D, 0xA3, 0xB6, 0xC7, 0xC3, 0xC4, 0xB5, 0x9F, 0x98, 0x91, 0x88, 0x7E, 0x72, 0x67, 0x4C, 0x47, 0x43, 0x43, 0x4C, 0x4D, 0x65, 0x6D, 0x73, 0x7F, 0x96, 0x98, 0xA6, 0xAF, 0xAE, 0xB3, 0xAE, 0xA6, 0x96, 0x93, 0x86, 0x6D, 0x6F, 0x63, 0x5E, 0x6A, 0x5C, 0x6E, 0x6D, 0x73, 0x7A, 0x79, 0x7B, 0x7D, 0x87, 0x93, 0x87, 0x82, 0x7F, 0x6F, 0x79, 0x73, 0x81, 0x8A, 0x8B, 0x8E, 0x83, 0x82, 0x81, 0x80, 0x97, 0x98, 0x9C, 0xAC, 0xA4, 0x9E, 0x8D, 0x70, 0x63, 0x4E, 0x4A, 0x51, 0x47, 0x57, 0x5A, 0x5D, 0x63, 0x68, 0x7A, 0x99, 0xB2, 0xBD, 0xBB, 0xC3, 0xB0, 0xA8, 0xA5, 0x92, 0x9A, 0x8C, 0x82, 0x67, 0x53, 0x48, 0x43, 0x47, 0x49, 0x50, 0x62, 0x63, 0x75, 0x8F, 0x8E, 0x9C, 0xA1, 0xA6, 0xA8, 0xA7, 0xA7, 0xA3, 0x9C, 0x96, 0x7E, 0x6F, 0x6C, 0x64, 0x69, 0x69, 0x70, 0x6E, 0x6D, 0x79, 0x75, 0x77, 0x83, 0x7F, 0x88, 0x8A, 0x79, 0x7A, 0x7B, 0x7F, 0x7C, 0x7D, 0x83, 0x86, 0x81, 0x75, 0x7C, 0x86, 0x8E, 0xA9, 0xAB, 0xA6, 0xAB, 0x9A, 0x8C, 0x79, 0x64, 0x60, 0x5C, 0x50, 0x4E, 0x49, 0x4E, 0x4E, 0x5F, 0x69, 0x7A, 0x9A, 0xA6, 0xB8, 0xBB, 0xBB, 0xAF, 0xAF, 0xA5, 0xA1, 0x9C, 0x8E, 0x79, 0x61, 0x5A, 0x4C, 0x44, 0x4C, 0x52, 0x4F, 0x65, 0x66, 0x78, 0x91, 0x91, 0x9C, 0xA5, 0xA7, 0xA2, 0x9C, 0x99, 0x8E, 0x85, 0x8D, 0x81, 0x79, 0x7C, 0x74, 0x78, 0x70, 0x75, 0x77, 0x6C, 0x6E, 0x6F, 0x73, 0x7C, 0x73, 0x75, 0x83, 0x80, 0x8C, 0x94, 0x94, 0x88, 0x7B, 0x79, 0x7D, 0x85, 0xA0, 0x9F, 0xA4, 0xA8, 0x8D, 0x8C, 0x77, 0x63, 0x5C, 0x58, 0x4E, 0x52, 0x4E, 0x53, 0x5A, 0x6B, 0x79, 0x79, 0xA6, 0xA9, 0xAD, 0xCD, 0xBD, 0xB8, 0xB2, 0x9C, 0x98, 0x94, 0x88, 0x78, 0x5D, 0x55, 0x49, 0x32, 0x4D, 0x48, 0x3B, 0x5F, 0x69, 0x76, 0x9A, 0x9D, 0xAB, 0xA5, 0xB2, 0xA9, 0x95, 0xA1, 0x8E, 0x80, 0x8D, 0x7F, 0x6A, 0x7B, 0x76, 0x75, 0x6F, 0x76, 0x73, 0x79, 0x96, 0x84, 0x78, 0x7F, 0x67, 0x74, 0x6E, 0x74, 0x8A, 0x79, 0x7A, 0x6E, 0x6C, 0x8E, 0x93, 0x8D, 0xAE, 0xA8, 0xB4, 0xAD, 0x98, 0x7B, 0x54, 0x4C, 0x4F, 0x49, 0x3F, 0x46, 0x4F, 0x61, 0x80, 0x8F, 0xA0, 0xAC, 0xAD, 0xC9, 0xBE, 0xBA, 0xB7, 0x9D, 0x9D, 0x95, 0x7E, 0x72, 0x52, 0x4C, 0x3F, 0x30, 0x45, 0x50, 0x5C, 0x6A, 0x6D, 0x90, 0xA4, 0xA8, 0xB9, 0xA2, 0xA9, 0x99, 0x8F, 0x8C, 0x7A, 0x6B, 0x75, 0x6D, 0x5B, 0x70, 0x70, 0x78, 0x85, 0x97, 0x9B, 0x93, 0x8B, 0x8B, 0x7C, 0x77, 0x72, 0x67, 0x7C, 0x7B, 0x7A, 0x7F, 0x72, 0x75, 0x85, 0x89, 0x9A, 0x99, 0x98, 0xA8, 0x9B, 0x90, 0x7E, 0x67, 0x57, 0x51, 0x49, 0x39, 0x49, 0x5C, 0x68, 0x86, 0x8D, 0x99, 0xB6, 0xAC, 0xC0, 0xC1, 0xB6, 0xBC, 0xA0, 0x9A, 0x96, 0x71, 0x5B, 0x50, 0x47, 0x44, 0x3B, 0x40, 0x57, 0x59, 0x66, 0x81, 0x8E, 0xB0, 0xB0, 0xAD, 0xAE, 0x9D, 0x96, 0x8C, 0x78, 0x7E, 0x75, 0x6E, 0x6F, 0x63, 0x6D, 0x7C, 0x7D, 0x76, 0x94, 0x93, 0x8C, 0x93, 0x91, 0x82, 0x76, 0x6E, 0x6A, 0x7F, 0x73, 0x7E, 0x75, 0x65, 0x7C, 0x81, 0x80, 0x92, 0x9B, 0x9E, 0xAC, 0x9C, 0x98, 0x81, 0x75, 0x58, 0x55, 0x61, 0x33, 0x4D, 0x5F, 0x66, 0x82, 0x8F, 0x99, 0xAF, 0xA6, 0xAB, 0xAE, 0xAD, 0xB5, 0x9D, 0x99, 0x95, 0x7C, 0x67, 0x58, 0x4F, 0x53, 0x45, 0x47, 0x56, 0x64, 0x70, 0x7A, 0x7A, 0xA0, 0xA8, 0x9F, 0xA9, 0xA0, 0x9F, 0x95, 0x87, 0x81, 0x75, 0x6F, 0x71, 0x5B, 0x75, 0x70, 0x6E, 0x82, 0x7D, 0x97, 0x96, 0x84, 0x90, 0x90, 0x7B, 0x7F, 0x6A, 0x71, 0x82, 0x71, 0x7B, 0x6F, 0x72, 0x83, 0x85, 0x84, 0x98, 0x9A, 0xA2, 0x9E, 0x8C, 0x87, 0x79, 0x6C, 0x56, 0x6A, 0x51, 0x48, 0x61, 0x5C, 0x74, 0x7A, 0x7D, 0xA8, 0xA3, 0xA9, 0xB8, 0xA8, 0xB4, 0xAB, 0x98, 0x96, 0x83, 0x73, 0x67, 0x54, 0x54, 0x47, 0x49, 0x4E, 0x57, 0x63, 0x6C, 0x83, 0x9A, 0xAB, 0xAE, 0xA8, 0xAD, 0x9E, 0x91, 0x86, 0x79, 0x7B, 0x78, 0x67, 0x64, 0x6A, 0x6D, 0x7C, 0x70, 0x74, 0x96, 0x9A, 0x85, 0x95, 0x8E, 0x83, 0x87, 0x6F, 0x61, 0x81, 0x7C, 0x74, 0x7B, 0x6D, 0x88, 0x7C, 0x76, 0x8D, 0x92, 0x99, 0xA9, 0x98, 0x96, 0x8F, 0x7C, 0x72, 0x4C, 0x77, 0x51, 0x3B, 0x5F, 0x46, 0x6A, 0x7F, 0x7B, 0xA6, 0xB1, 0xA5, 0xBC, 0xAD, 0xB8, 0xAF, 0xA3, 0xA0, 0x92, 0x70, 0x65, 0x5E, 0x49, 0x46, 0x38, 0x49, 0x51, 0x51, 0x62, 0x83, 0x87, 0xAD, 0xAB, 0xB3, 0xB7, 0xA0, 0xA7, 0x92, 0x89, 0x8F, 0x7E, 0x5E, 0x63, 0x54, 0x68, 0x72, 0x6A, 0x67, 0x9B, 0x9D, 0x78, 0x93, 0x8E, 0x8F, 0x92, 0x79, 0x6A, 0x80, 0x79, 0x7F, 0x76, 0x6A, 0x7D, 0x7F, 0x73, 0x7A, 0x87, 0x9E, 0xA8, 0x93, 0x9A, 0x9E, 0x86, 0x76, 0x59, 0x6E, 0x65, 0x38, 0x5E, 0x4F, 0x5B, 0x74, 0x74, 0x8C, 0xA6, 0xA4, 0xBC, 0xB6, 0xA8, 0xBD, 0xA5, 0xA3, 0x99, 0x7E, 0x7B, 0x6E, 0x49, 0x51, 0x41, 0x38, 0x4F, 0x4B, 0x55, 0x6B, 0x80, 0x93, 0xA9, 0xB1, 0xC0, 0xB4, 0xAB, 0x9C, 0x8F, 0x8D, 0x76, 0x76, 0x68, 0x5B, 0x62, 0x6B, 0x55, 0x74, 0x83, 0x79, 0x95, 0x97, 0x93, 0x8E, 0x91, 0x80, 0x82, 0x7C, 0x76, 0x77, 0x7E, 0x77, 0x78, 0x6B, 0x64, 0x7D, 0x7F, 0x8C, 0x8B, 0x98, 0xA4, 0xAB, 0x97, 0x95, 0x87, 0x8A, 0x60, 0x56, 0x6A, 0x37, 0x56, 0x50, 0x4D, 0x62, 0x7A, 0x8E, 0xAA, 0xA3, 0xB9, 0xC5, 0xB9, 0xB3, 0xA3, 0xA5, 0x98, 0x8B, 0x6D, 0x68, 0x58, 0x56, 0x3D, 0x37, 0x40, 0x54, 0x57, 0x6B, 0x78, 0x91, 0xAF, 0xAA, 0xB0, 0xAD, 0xB7, 0xA5, 0x93, 0x8A, 0x87, 0x76, 0x72, 0x60, 0x59, 0x61, 0x5E, 0x5C, 0x68, 0x75, 0x8F, 0x97, 0x97, 0x9F, 0xA7, 0x96, 0x89, 0x80, 0x7F, 0x82, 0x73, 0x72, 0x6A, 0x73, 0x60, 0x62, 0x5C, 0x74, 0x84, 0x8C, 0x95, 0x9A, 0xA7, 0xAC, 0xA6, 0x96, 0x8B, 0x85, 0x77, 0x62, 0x4C, 0x5D, 0x4F, 0x3A, 0x6D, 0x5A, 0x78, 0x8C, 0x90, 0xA5, 0xB7, 0xA4, 0xAE, 0xB1, 0xA5, 0xB4, 0x91, 0x83, 0x83, 0x71, 0x5F, 0x5B, 0x38, 0x4E, 0x50, 0x4F, 0x5E, 0x66, 0x7D, 0x95, 0x95, 0xA0, 0xAF, 0xAB, 0xAF, 0x9A, 0x96, 0x80, 0x84, 0x7C, 0x67, 0x6E, 0x61, 0x61, 0x6A, 0x6A, 0x7B, 0x83, 0x7A, 0x9B, 0x99, 0x99, 0x95, 0x87, 0x8C, 0x7A, 0x77, 0x78, 0x7A, 0x71, 0x82, 0x6D, 0x68, 0x6F, 0x69, 0x71, 0x7F, 0x78, 0x89, 0xA4, 0x96, 0xA6, 0xA5, 0x9B, 0x9A, 0x89, 0x71, 0x79, 0x5E, 0x5D, 0x4B, 0x56, 0x4F, 0x48, 0x72, 0x74, 0x92, 0x9F, 0xA8, 0xB1, 0xBD, 0xAA, 0xAD, 0x9F, 0xA3, 0x9B, 0x84, 0x78, 0x65, 0x54, 0x45, 0x4A, 0x3D, 0x52, 0x54, 0x5D, 0x61, 0x83, 0x9D, 0xA3, 0xB7, 0xB0, 0xA9, 0xB2, 0xAA, 0x8F, 0x95, 0x73, 0x68, 0x69, 0x57, 0x61, 0x5D, 0x5D, 0x6B, 0x7A, 0x7B, 0x97, 0x8C, 0x98, 0xA8, 0x97, 0xA0, 0x8D, 0x80, 0x85, 0x7F, 0x62, 0x6E, 0x54, 0x6B, 0x64, 0x5A, 0x80, 0x6C, 0x78, 0x8F, 0x8B, 0x85, 0xAD, 0x98, 0xA8, 0xAD, 0x9E, 0xA3, 0x9C, 0x85, 0x6E, 0x68, 0x5A, 0x5C, 0x41, 0x49, 0x49, 0x4B, 0x5E, 0x70, 0x81, 0x9E, 0xAF, 0xA4, 0xCC, 0xC1, 0x9F, 0xC7, 0xA2, 0x87, 0xA2, 0x73, 0x66, 0x69, 0x42, 0x43, 0x4A, 0x39, 0x5A, 0x5B, 0x59, 0x7A, 0x86, 0x9E, 0xAD, 0xAD, 0xB3, 0xB6, 0xA2, 0xAC, 0x97, 0x80, 0x7D, 0x6C, 0x65, 0x5F, 0x56, 0x54, 0x66, 0x5F, 0x7E, 0x7F, 0x88, 0x95, 0x98, 0x9D, 0x9E, 0x95, 0x8F, 0x95, 0x7C, 0x84, 0x71, 0x66, 0x61, 0x6B, 0x62, 0x73, 0x6C, 0x6E, 0x88, 0x83, 0x8D, 0x7D, 0x8E, 0x81, 0x8D, 0x9C, 0xA9, 0x9D, 0x9F, 0xA5, 0x8A, 0x8D, 0x7D, 0x6F, 0x66, 0x62, 0x4B, 0x51, 0x41, 0x42, 0x52, 0x61, 0x81, 0x8C, 0xA9, 0xAC, 0xB4, 0xBB, 0xBE, 0xAC, 0xA4, 0xB2, 0x92, 0x90, 0x88, 0x68, 0x61, 0x53, 0x39, 0x43, 0x3F, 0x3F, 0x5F, 0x62, 0x79, 0x82, 0x92, 0xA8, 0xB5, 0xB4, 0xB8, 0xA7, 0xAA, 0xA5, 0x81, 0x8B, 0x62, 0x5E, 0x5E, 0x61, 0x5F, 0x62, 0x61, 0x6D, 0x7E, 0x87, 0x95, 0x8C, 0x97, 0x96, 0x98, 0x92, 0x94, 0x77, 0x7E, 0x74, 0x67, 0x74, 0x66, 0x72, 0x74, 0x72, 0x79, 0x7B, 0x7B, 0x90, 0x89, 0x95, 0x92, 0x7F, 0x83, 0x78, 0x85, 0x93, 0x91, 0x97, 0x8E, 0x8F, 0x92, 0x8C, 0x8A, 0x81, 0x77, 0x68, 0x5B, 0x51, 0x44, 0x48, 0x4D, 0x56, 0x73, 0x81, 0x99, 0xA5, 0xA4, 0xB7, 0xB4, 0xB4, 0xB9, 0xA9, 0xA3, 0x97, 0x8C, 0x80, 0x6A, 0x5C, 0x4B, 0x3A, 0x41, 0x41, 0x50, 0x5C, 0x62, 0x75, 0x8A, 0xA2, 0xAC, 0xB1, 0xB1, 0xAF, 0xA9, 0xA6, 0x90, 0x94, 0x6F, 0x60, 0x67, 0x54, 0x66, 0x66, 0x62, 0x6B, 0x73, 0x7B, 0x94, 0x90, 0x93, 0x99, 0x92, 0x91, 0x8C, 0x81, 0x7E, 0x76, 0x70, 0x6B, 0x64, 0x72, 0x78, 0x7E, 0x87, 0x7D, 0x7A, 0x88, 0x85, 0x90, 0x96, 0x84, 0x8E, 0x88, 0x75, 0x7A, 0x72, 0x81, 0x8C, 0x80, 0x88, 0x8C, 0x8F, 0x94, 0x90, 0x87, 0x83, 0x7D, 0x6E, 0x66, 0x58, 0x4D, 0x4D, 0x4F, 0x5C, 0x62, 0x7E, 0x97, 0x9C, 0xA9, 0xB1, 0xB0, 0xB6, 0xB0, 0xAD, 0xAD, 0x9E, 0x90, 0x83, 0x6F, 0x57, 0x4A, 0x45, 0x44, 0x3F, 0x49, 0x51, 0x5A, 0x67, 0x82, 0x9C, 0xA9, 0xB2, 0xB7, 0xB8, 0xB0, 0xA8, 0xA0, 0x93, 0x74, 0x6A, 0x60, 0x5F, 0x52, 0x55, 0x64, 0x6B, 0x6D, 0x82, 0xA2, 0x80, 0x98, 0x9B, 0x94, 0x98, 0x87, 0x7F, 0x82, 0x76, 0x74, 0x78, 0x64, 0x64, 0x5F, 0x77, 0x8B, 0x8C, 0x8E, 0x8E, 0x78, 0x87, 0x8E, 0x92, 0x9A, 0x83, 0x7D, 0x77, 0x66, 0x72, 0x83, 0x7A, 0x7E, 0x77, 0x88, 0x8D, 0x8D, 0xA3, 0x9C, 0x92, 0x8F, 0x7C, 0x7C, 0x6F, 0x5B, 0x56, 0x46, 0x48, 0x50, 0x61, 0x71, 0x7A, 0x8F, 0x9E, 0xA9, 0xAE, 0xB2, 0xB2, 0xAE, 0xAE, 0xA9, 0xA9, 0xA0, 0x89, 0x70, 0x5A, 0x3E, 0x43, 0x43, 0x44, 0x46, 0x48, 0x5A, 0x62, 0x78, 0x97, 0xA8, 0xB8, 0xB5, 0xB8, 0xC4, 0x9E, 0xA5, 0x93, 0x73, 0x70, 0x60, 0x5D, 0x5F, 0x50, 0x54, 0x61, 0x6C, 0x84, 0x8D, 0x97, 0x91, 0xA3, 0xA1, 0x9A, 0xA0, 0x8E, 0x85, 0x79, 0x69, 0x69, 0x65, 0x56, 0x5E, 0x59, 0x6A, 0x80, 0x8E, 0x98, 0x94, 0x94, 0x92, 0x96, 0x91, 0x9D, 0x91, 0x7D, 0x78, 0x77, 0x74, 0x87, 0x6F, 0x7C, 0x83, 0x5B, 0x90, 0x84, 0x8D, 0x9B, 0x80, 0x82, 0x82, 0x6D, 0x80, 0x6B, 0x56, 0x62, 0x46, 0x62, 0x68, 0x71, 0x8A, 0x94, 0x91, 0xAB, 0xAA, 0xAC, 0xB0, 0xA1, 0xA0, 0x9F, 0x9C, 0x98, 0x94, 0x6E, 0x66, 0x52, 0x4A, 0x4C, 0x49, 0x50, 0x50, 0x58, 0x65, 0x6C, 0x87, 0x9D, 0xA8, 0xB2, 0xA9, 0xAB, 0xA6, 0xA3, 0x9F, 0x8D, 0x82, 0x6D, 0x5E, 0x62, 0x58, 0x5F, 0x6E, 0x71, 0x83, 0x84, 0x89, 0x8E, 0x89, 0x9B, 0x8C, 0x8D, 0x8A, 0x79, 0x7D, 0x71, 0x70, 0x76, 0x6E, 0x67, 0x6B, 0x73, 0x8C, 0x90, 0x93, 0x88, 0x7C, 0x81, 0x80, 0x90, 0x93, 0x8D, 0x85, 0x7E, 0x76, 0x7F, 0x84, 0x8A, 0x88, 0x7E, 0x80, 0x7D, 0x82, 0x89, 0x88, 0x7C, 0x7D, 0x72, 0x71, 0x73, 0x66, 0x61, 0x5D, 0x59, 0x5D, 0x6A, 0x73, 0x88, 0x95, 0xA3, 0xAC, 0xB1, 0xB3, 0xAD, 0xA4, 0x95, 0x8F, 0x8E, 0x8F, 0x87, 0x78, 0x68, 0x59, 0x55, 0x53, 0x4F, 0x52, 0x58, 0x5C, 0x64, 0x6A, 0x79, 0x8A, 0x8E, 0x9B, 0xA8, 0xAE, 0xB7, 0xB0, 0xA6, 0x9C, 0x88, 0x82, 0x77, 0x72, 0x66, 0x58, 0x58, 0x54, 0x5F, 0x7C, 0x81, 0x85, 0x9A, 0x8E, 0x8E, 0x94, 0x91, 0x91, 0x8C, 0x7A, 0x6D, 0x7C, 0x6F, 0x71, 0x70, 0x5E, 0x69, 0x6D, 0x7D, 0x8C, 0x95, 0x94, 0x97, 0x83, 0x8D, 0x98, 0x96, 0x9E, 0x8E, 0x85, 0x7A, 0x6D, 0x74, 0x77, 0x74, 0x6C, 0x69, 0x7A, 0x67, 0x80, 0x7B, 0x80, 0x8F, 0x88, 0x93, 0x8B, 0x7B, 0x7A, 0x70, 0x64, 0x79, 0x65, 0x70, 0x6D, 0x69, 0x7B, 0x8D, 0x97, 0xA3, 0xA1, 0xA0, 0x96, 0x92, 0x9F, 0x98, 0xA1, 0x97, 0x8D, 0x84, 0x6B, 0x64, 0x60, 0x4D, 0x52, 0x4A, 0x4F, 0x5D, 0x5E, 0x68, 0x70, 0x73, 0x8C, 0xA5, 0xB0, 0xBB, 0xBB, 0xB4, 0xAA, 0x97, 0x8D, 0x8C, 0x71, 0x68, 0x5B, 0x52, 0x57, 0x5A, 0x6E, 0x7F, 0x81, 0x8B, 0x90, 0x8B, 0x94, 0x93, 0x95, 0x8B, 0x7A, 0x76, 0x6F, 0x70, 0x71, 0x6B, 0x73, 0x65, 0x66, 0x77, 0x7D, 0x90, 0x9A, 0x98, 0x98, 0x92, 0x94, 0x9A, 0x99, 0x99, 0x8E, 0x87, 0x6B, 0x65, 0x68, 0x65, 0x71, 0x69, 0x6C, 0x6E, 0x73, 0x7A, 0x8C, 0x8E, 0x94, 0x97, 0x8F, 0x7E, 0x7D, 0x7D, 0x6E, 0x76, 0x66, 0x61, 0x64, 0x64, 0x72, 0x8F, 0x96, 0xA2, 0xA6, 0x9F, 0x9E, 0x96, 0x98, 0x97, 0x99, 0x95, 0x8F, 0x86, 0x76, 0x67, 0x61, 0x53, 0x4A, 0x4D, 0x52, 0x57, 0x66, 0x67, 0x7A, 0x80, 0x7B, 0x94, 0xA1, 0xAE, 0xBD, 0xBA, 0xB2, 0xA1, 0x86, 0x8F, 0x78, 0x73, 0x67, 0x53, 0x5B, 0x4F, 0x5D, 0x77, 0x84, 0x8B, 0x98, 0x88, 0x93, 0x90, 0x91, 0x98, 0x86, 0x7E, 0x6F, 0x66, 0x62, 0x6B, 0x6B, 0x7B, 0x62, 0x73, 0x7C, 0x6E, 0x9C, 0x99, 0xA2, 0xA6, 0x96, 0x91, 0x94, 0x90, 0x9A, 0x8C, 0x85, 0x79, 0x5F, 0x65, 0x5C, 0x65, 0x6E, 0x68, 0x6F, 0x75, 0x6F, 0x86, 0x8A, 0x97, 0xA4, 0x97, 0x90, 0x89, 0x77, 0x76, 0x72, 0x65, 0x6F, 0x65, 0x67, 0x69, 0x72, 0x88, 0x96, 0x9D, 0xAA, 0x98, 0x9C, 0x99, 0x8C, 0x9B, 0x97, 0x95, 0x95, 0x85, 0x6F, 0x6B, 0x59, 0x58, 0x51, 0x52, 0x50, 0x59, 0x62, 0x6B, 0x76, 0x7D, 0x8B, 0x92, 0xA6, 0xB1, 0xB9, 0xB9, 0xAD, 0x9F, 0x95, 0x74, 0x7A, 0x68, 0x60, 0x61, 0x52, 0x5E, 0x66, 0x6C, 0x81, 0x90, 0x8C, 0x9D, 0x8D, 0x96, 0x93, 0x89, 0x8D, 0x7C, 0x73, 0x6E, 0x63, 0x69, 0x69, 0x6A, 0x74, 0x68, 0x79, 0x83, 0x8D, 0xA2, 0x9B, 0x9F, 0xA0, 0x94, 0x97, 0x8D, 0x8D, 0x8E, 0x81, 0x7B, 0x6C, 0x60, 0x5E, 0x60, 0x67, 0x65, 0x72, 0x7A, 0x7A, 0x85, 0x8A, 0x96, 0x99, 0x9D, 0x95, 0x86, 0x81, 0x76, 0x6C, 0x6F, 0x64, 0x64, 0x6D, 0x68, 0x77, 0x77, 0x8F, 0xA0, 0x9C, 0xA8, 0xA2, 0x96, 0x9B, 0x8F, 0x90, 0x9C, 0x86, 0x86, 0x7E, 0x6A, 0x60, 0x52, 0x4E, 0x4B, 0x4C, 0x5B, 0x6C, 0x6F, 0x79, 0x83, 0x8C, 0x96, 0xA1, 0xB0, 0xB9, 0xAE, 0xA2, 0x9F, 0x88, 0x81, 0x78, 0x73, 0x69, 0x5F, 0x60, 0x5E, 0x61, 0x6C, 0x82, 0x8C, 0x8B, 0x8B, 0x91, 0x8B, 0x8B, 0x87, 0x88, 0x85, 0x73, 0x74, 0x71, 0x68, 0x68, 0x68, 0x77, 0x76, 0x7B, 0x91, 0x8A, 0x97, 0xA0, 0x9D, 0xA3, 0x96, 0x86, 0x92, 0x81, 0x7E, 0x84, 0x79, 0x71, 0x60, 0x5F, 0x5E, 0x61, 0x6D, 0x7A, 0x7F, 0x85, 0x77, 0x7E, 0x8A, 0x8C, 0x9B, 0x9F, 0x9B, 0x95, 0x8D, 0x8A, 0x7F, 0x71, 0x70, 0x66, 0x62, 0x5D, 0x65, 0x6F, 0x76, 0x7D, 0x86, 0x8A, 0x93, 0x9A, 0x9E, 0x9F, 0x9C, 0x9E, 0x9D, 0x96, 0x8E, 0x92, 0x81, 0x71, 0x60, 0x4F, 0x48, 0x48, 0x4C, 0x5E, 0x62, 0x6B, 0x7B, 0x7A, 0x8F, 0x98, 0xAA, 0xB8, 0xB6, 0xAB, 0xA8, 0x96, 0x8F, 0x86, 0x77, 0x73, 0x60, 0x5F, 0x58, 0x5D, 0x63, 0x74, 0x70, 0x8D, 0x7C, 0x83, 0x90, 0x8B, 0xA3, 0x8C, 0x90, 0x81, 0x74, 0x70, 0x79, 0x67, 0x7D, 0x71, 0x6F, 0x80, 0x6C, 0x84, 0x86, 0x91, 0x9C, 0x9C, 0x98, 0xA3, 0x87, 0x8F, 0x86, 0x7B, 0x83, 0x69, 0x6C, 0x5E, 0x59, 0x66, 0x6D, 0x73, 0x86, 0x81, 0x89, 0x83, 0x78, 0x84, 0x83, 0x95, 0x92, 0x99, 0x95, 0x8E, 0x8D, 0x8C, 0x7D, 0x7A, 0x72, 0x68, 0x6D, 0x63, 0x6B, 0x6C, 0x70, 0x6D, 0x84, 0x87, 0x8D, 0x97, 0x97, 0x97, 0x9A, 0x92, 0x9F, 0x9C, 0x89, 0x9B, 0x75, 0x79, 0x65, 0x50, 0x55, 0x50, 0x5C, 0x6F, 0x6A, 0x75, 0x77, 0x73, 0x93, 0x8E, 0xA7, 0xAC, 0xA1, 0xA4, 0x96, 0x89, 0x90, 0x80, 0x7C, 0x73, 0x65, 0x6E, 0x6C, 0x6F, 0x72, 0x71, 0x6C, 0x78, 0x78, 0x87, 0x8E, 0x94, 0x9A, 0x89, 0x83, 0x86, 0x7F, 0x83, 0x7E, 0x6C, 0x73, 0x68, 0x6F, 0x75, 0x75, 0x7E, 0x7B, 0x87, 0x98, 0x9A, 0xA2, 0x99, 0x8F, 0x90, 0x7F, 0x86, 0x7C, 0x77, 0x72, 0x67, 0x5A, 0x71, 0x6F, 0x71, 0x89, 0x6B, 0x7E, 0x7A, 0x74, 0x83, 0x86, 0x8E, 0x9E, 0x90, 0x9A, 0x9D, 0x88, 0x92, 0x78, 0x72, 0x73, 0x63, 0x6A, 0x6B, 0x5E, 0x76, 0x71, 0x74, 0x88, 0x7C, 0x90, 0x99, 0x97, 0xA3, 0x9C, 0x98, 0x9C, 0x97, 0x9B, 0x8C, 0x7E, 0x70, 0x51, 0x54, 0x4F, 0x4C, 0x5E, 0x60, 0x64, 0x73, 0x74, 0x8B, 0x9B, 0xA1, 0xB2, 0xAC, 0xAE, 0xA3, 0x9A, 0x90, 0x84, 0x75, 0x6F, 0x63, 0x5F, 0x5C, 0x64, 0x69, 0x6E, 0x70, 0x7E, 0x8D, 0x7E, 0x9D, 0x8C, 0x9B, 0x99, 0x8A, 0x8B, 0x78, 0x6D, 0x75, 0x67, 0x70, 0x80, 0x6C, 0x89, 0x74, 0x7A, 0x86, 0x7B, 0x92, 0x9E, 0x91, 0xA0, 0x8C, 0x87, 0x91, 0x7D, 0x86, 0x79, 0x6E, 0x67, 0x5E, 0x61, 0x6C, 0x6B, 0x80, 0x7F, 0x76, 0x85, 0x86, 0x86, 0x8F, 0x8C, 0x93, 0x9C, 0x93, 0x95, 0x8A, 0x87, 0x88, 0x79, 0x75, 0x71, 0x64, 0x68, 0x64, 0x68, 0x71, 0x6E, 0x7A, 0x7A, 0x76, 0x8C, 0x8E, 0x94, 0x9F, 0x97, 0xA3, 0xA3, 0xA1, 0xAB, 0x99, 0x89, 0x77, 0x5D, 0x57, 0x51, 0x4C, 0x4D, 0x4E, 0x56, 0x66, 0x70, 0x82, 0x91, 0x9C, 0xA8, 0xB1, 0xB7, 0xB1, 0xA5, 0x96, 0x8A, 0x7F, 0x76, 0x69, 0x5D, 0x5A, 0x61, 0x62, 0x68, 0x70, 0x70, 0x7F, 0x84, 0x8C, 0x98, 0x9C, 0x9B, 0x92, 0x8E, 0x84, 0x7B, 0x76, 0x70, 0x6F, 0x6E, 0x6C, 0x75, 0x71, 0x73, 0x78, 0x82, 0x8F, 0x99, 0x9E, 0x99, 0x9B, 0x94, 0x95, 0x8A, 0x85, 0x74, 0x6E, 0x5A, 0x73, 0x5B, 0x52, 0x7C, 0x5C, 0x83, 0x82, 0x81, 0x93, 0x87, 0x89, 0x96, 0x88, 0x9B, 0x98, 0x8D, 0x9C, 0x84, 0x8E, 0x7E, 0x6C, 0x71, 0x6A, 0x62, 0x6B, 0x59, 0x67, 0x71, 0x71, 0x80, 0x80, 0x83, 0x95, 0x94, 0x9D, 0xA5, 0x99, 0xAA, 0x9C, 0xA1, 0xA1, 0x8E, 0x7B, 0x69, 0x51, 0x55, 0x4E, 0x4A, 0x52, 0x4A, 0x64, 0x66, 0x79, 0x8F, 0x92, 0xA8, 0xB0, 0xB2, 0xB8, 0xA5, 0x9D, 0x95, 0x86, 0x8B, 0x73, 0x65, 0x5E, 0x51, 0x5E, 0x63, 0x64, 0x73, 0x74, 0x7D, 0x89, 0x89, 0x9D, 0x9B, 0x98, 0x9E, 0x8B, 0x86, 0x84, 0x6A, 0x6F, 0x6A, 0x60, 0x77, 0x68, 0x72, 0x7A, 0x7A, 0x8B, 0x8F, 0x98, 0x9E, 0x99, 0x9D, 0x9A, 0x93, 0x86, 0x82, 0x78, 0x6A, 0x6E, 0x61, 0x5F, 0x60, 0x63, 0x6C, 0x73, 0x7C, 0x87, 0x8D, 0x88, 0x8B, 0x96, 0x84, 0x97, 0x9F, 0x95, 0x9B, 0x8C, 0x87, 0x89, 0x72, 0x68, 0x6A, 0x5D, 0x69, 0x5D, 0x61, 0x6D, 0x6E, 0x74, 0x7D, 0x89, 0x94, 0x91, 0xB1, 0x9F, 0x9C, 0xB9, 0x98, 0xA2, 0x93, 0x89, 0x77, 0x64, 0x5E, 0x4D, 0x54, 0x4E, 0x4C, 0x59, 0x67, 0x72, 0x80, 0x81, 0x95, 0xA5, 0xA6, 0xB0, 0xA5, 0xAB, 0x9A, 0x8C, 0x82, 0x7D, 0x6D, 0x73, 0x54, 0x82, 0x6D, 0x44, 0x98, 0x6A, 0x77, 0x7D, 0x7F, 0xA0, 0x7F, 0x77, 0x9D, 0x81, 0x8E, 0x7B, 0x75, 0x91, 0x6D, 0x79, 0x7E, 0x76, 0x82, 0x70, 0x7C, 0x94, 0x76, 0x92, 0x89, 0x85, 0x8A, 0x7B, 0x8B, 0x80, 0x72, 0x8B, 0x76, 0x79, 0x7B, 0x6F, 0x86, 0x7C, 0x82, 0x85, 0x81, 0x86, 0x76, 0x75, 0x8A, 0x80, 0x8E, 0x8F, 0x88, 0x93, 0x7E, 0x75, 0x7E, 0x6B, 0x6D, 0x71, 0x62, 0x69, 0x68, 0x6F, 0x87, 0x77, 0x84, 0x94, 0x92, 0x9E, 0x9A, 0xA3, 0xAE, 0x9E, 0x99, 0xA0, 0x86, 0x7C, 0x67, 0x6C, 0x55, 0x51, 0x6A, 0x3F, 0x5C, 0x60, 0x5C, 0x7B, 0x6F, 0x91, 0x9E, 0x99, 0xAD, 0x9E, 0xAB, 0xAC, 0x8B, 0x9A, 0x86, 0x79, 0x79, 0x64, 0x72, 0x6B, 0x63, 0x6D, 0x68, 0x7C, 0x78, 0x6F, 0x90, 0x87, 0x7B, 0x88, 0x90, 0x88, 0x75, 0x8A, 0x90, 0x6D, 0x84, 0x8F, 0x7C, 0x80, 0x84, 0x78, 0x7F, 0x7B, 0x7C, 0x83, 0x8A, 0x89, 0x75, 0x88, 0x8B, 0x75, 0x79, 0x89, 0x85, 0x7F, 0x74, 0x84, 0x8A, 0x79, 0x71, 0x75, 0x80, 0x7A, 0x70, 0x85, 0x82, 0x7C, 0x7F, 0x7C, 0x85, 0x8A, 0x85, 0x81, 0x8F, 0x96, 0x77, 0x7C, 0x90, 0x7B, 0x75, 0x77, 0x83, 0x77, 0x74, 0x6E, 0x81, 0x77, 0x72, 0x85, 0x80, 0x89, 0x80, 0x91, 0x8C, 0x87, 0x91, 0x87, 0x86, 0x88, 0x84, 0x77, 0x7F, 0x77, 0x71, 0x7F, 0x71, 0x75, 0x83, 0x7F, 0x71, 0x82, 0x82, 0x74, 0x89, 0x7B, 0x7E, 0x84, 0x7C, 0x7E, 0x81, 0x7F, 0x79, 0x83, 0x7D, 0x85, 0x7D, 0x83, 0x86, 0x81, 0x85, 0x83, 0x86, 0x89, 0x89, 0x80, 0x8A, 0x83, 0x81, 0x7B, 0x80, 0x7C, 0x78, 0x7A, 0x7A, 0x7B, 0x77, 0x76, 0x7A, 0x82, 0x72, 0x80, 0x7E, 0x7F, 0x81, 0x7D, 0x87, 0x84, 0x86, 0x7F, 0x87, 0x87, 0x7F, 0x84, 0x87, 0x7E, 0x7B, 0x82, 0x79, 0x7E, 0x7F, 0x77, 0x87, 0x89, 0x80, 0x85, 0x86, 0x80, 0x7B, 0x7D, 0x7C, 0x7B, 0x82, 0x75, 0x7D, 0x7F, 0x73, 0x7B, 0x88, 0x7F, 0x76, 0x8C, 0x7E, 0x7F, 0x80, 0x85, 0x7D, 0x80, 0x85, 0x7E, 0x7D, 0x83, 0x89, 0x7C, 0x86, 0x80, 0x86, 0x77, 0x7D, 0x85, 0x83, 0x7D, 0x7F, 0x7F, 0x7A, 0x7B, 0x7A, 0x82, 0x84, 0x79, 0x7E, 0x86, 0x74, 0x7B, 0x81, 0x86, 0x7D, 0x83, 0x87, 0x83, 0x77, 0x88, 0x83, 0x7D, 0x76, 0x85, 0x86, 0x6F, 0x82, 0x87, 0x83, 0x71, 0x7F, 0x8E, 0x86, 0x71, 0x92, 0x8B, 0x7E, 0x70, 0x7D, 0x82, 0x75, 0x7A, 0x7B, 0x87, 0x74, 0x7D, 0x72, 0x86, 0x8C, 0x79, 0x83, 0x8E, 0x88, 0x7E, 0x85, 0x83, 0x8B, 0x73, 0x78, 0x86, 0x7A, 0x79, 0x68, 0x8A, 0x84, 0x73, 0x81, 0x86, 0x87, 0x78, 0x7D, 0x8B, 0x88, 0x78, 0x86, 0x85, 0x7F, 0x80, 0x77, 0x84, 0x78, 0x84, 0x71, 0x79, 0x8B, 0x77, 0x80, 0x7E, 0x8C, 0x81, 0x7A, 0x86, 0x8A, 0x79, 0x85, 0x81, 0x81, 0x7F, 0x73, 0x7C, 0x7F, 0x79, 0x79, 0x7C, 0x84, 0x7E, 0x7A, 0x87, 0x81, 0x88, 0x7E, 0x8C, 0x81, 0x83, 0x80, 0x7D, 0x85, 0x82, 0x76, 0x78, 0x81, 0x77, 0x78, 0x7C, 0x8B, 0x7F, 0x79, 0x7D, 0x86, 0x7B, 0x84, 0x83, 0x86, 0x8E, 0x78, 0x7E, 0x86, 0x78, 0x7D, 0x77, 0x7A, 0x8A, 0x78, 0x79, 0x85, 0x88, 0x73, 0x84, 0x83, 0x89, 0x79, 0x89, 0x87, 0x82, 0x81, 0x70, 0x83, 0x73, 0x8E, 0x6A, 0x7D, 0x89, 0x76, 0x81, 0x78, 0x88, 0x84, 0x7D, 0x87, 0x89, 0x84, 0x82, 0x7B, 0x74, 0x88, 0x86, 0x70, 0x7C, 0x91, 0x72, 0x7A, 0x74, 0x85, 0x7B, 0x7E, 0x84, 0x7D, 0x96, 0x7A, 0x85, 0x75, 0x93, 0x76, 0x84, 0x6F, 0x96, 0x72, 0x66, 0x84, 0x88, 0x82, 0x6C, 0x90, 0x7D, 0x7C, 0x7F, 0x8F, 0x6F, 0x97, 0x7B, 0x82, 0x71, 0x95, 0x6E, 0x78, 0x81, 0x75, 0x91, 0x6E, 0x85, 0x86, 0x86, 0x76, 0x86, 0x77, 0x8D, 0x85, 0x7A, 0x7C, 0x8B, 0x7D, 0x6D, 0x79, 0x84, 0x7C, 0x78, 0x75, 0x95, 0x7C, 0x79, 0x82, 0x84, 0x87, 0x74, 0x96, 0x77, 0x8B, 0x7C, 0x85, 0x7C, 0x7A, 0x7E, 0x80, 0x7D, 0x75, 0x8D, 0x70, 0x8C, 0x6D, 0x82, 0x8B, 0x78, 0x75, 0x8A, 0x8A, 0x68, 0x8B, 0x94, 0x74, 0x80, 0x90, 0x6C, 0x9E, 0x70, 0x7E, 0x90, 0x77, 0x7B, 0x7B, 0x86, 0x6E, 0x85, 0x77, 0x76, 0x89, 0x72, 0x87, 0x7A, 0x84, 0x8D, 0x80, 0x78, 0x94, 0x84, 0x73, 0x83, 0x7D, 0x94, 0x62, 0x89, 0x7A, 0x7F, 0x7C, 0x5F, 0x9A, 0x7B, 0x6E, 0x92, 0x78, 0x92, 0x75, 0x85, 0x8A, 0x86, 0x80, 0x85, 0x77, 0x7B, 0x79, 0x6F, 0x81, 0x7E, 0x83, 0x7E, 0x82, 0x78, 0x85, 0x83, 0x87, 0x78, 0xA0, 0x71, 0x88, 0x71, 0x8D, 0x6E, 0x7D, 0x7E, 0x74, 0x8B, 0x75, 0x7D, 0x8C, 0x75, 0x80, 0x83, 0x7A, 0x90, 0x7A, 0x90, 0x7A, 0x91, 0x6B, 0x90, 0x6D, 0x8B, 0x77, 0x7F, 0x81, 0x7C, 0x73, 0x81, 0x79, 0x7F, 0x75, 0x90, 0x79, 0x86, 0x90, 0x6D, 0x9A, 0x6D, 0x94, 0x65, 0x91, 0x7D, 0x80, 0x73, 0x92, 0x6D, 0x8F, 0x74, 0x75, 0x96, 0x74, 0x6F, 0x91, 0x7E, 0x77, 0x86, 0x85, 0x89, 0x69, 0x93, 0x6E, 0x8E, 0x75, 0x9A, 0x71, 0x89, 0x77, 0x86, 0x68, 0x8A, 0x7A, 0x7F, 0x80, 0x7C, 0x89, 0x83, 0x8C, 0x68, 0x9C, 0x5C, 0x91, 0x74, 0x8F, 0x81, 0x94, 0x7B, 0x8D, 0x72, 0x76, 0x71, 0x72, 0x83, 0x74, 0x90, 0x74, 0x9A, 0x78, 0x87, 0x7A, 0x8B, 0x6D, 0x85, 0x82, 0x8C, 0x74, 0x7D, 0x91, 0x68, 0x87, 0x78, 0x92, 0x75, 0x85, 0x80, 0x80, 0x88, 0x6A, 0x90, 0x71, 0x83, 0x7B, 0x7D, 0x88, 0x74, 0x8A, 0x79, 0x8D, 0x86, 0x78, 0x7C, 0x80, 0x83, 0x78, 0x7A, 0x8B, 0x8E, 0x7D, 0x6F, 0x8B, 0x81, 0x6C, 0x78, 0x85, 0x88, 0x82, 0x88, 0x8C, 0x86, 0x84, 0x6F, 0x7A, 0x7B, 0x79, 0x6F, 0x7B, 0x8D, 0x79, 0x77, 0x87, 0x8D, 0x79, 0x7E, 0x81, 0x93, 0x75, 0x89, 0x8C, 0x81, 0x84, 0x7B, 0x7A, 0x79, 0x83, 0x70, 0x72, 0x89, 0x7A, 0x77, 0x7B, 0x88, 0x88, 0x6F, 0x8B, 0x8F, 0x83, 0x7D, 0x8C, 0x80, 0x7D, 0x82, 0x6C, 0x86, 0x7D, 0x6E, 0x86, 0x7E, 0x84, 0x73, 0x83, 0x89, 0x7B, 0x83, 0x8E, 0x80, 0x80, 0x8B, 0x7E, 0x84, 0x76, 0x82, 0x77, 0x7C, 0x76, 0x82, 0x7A, 0x79, 0x88, 0x7D, 0x82, 0x83, 0x83, 0x77, 0x88, 0x7C, 0x80, 0x7D, 0x88, 0x83, 0x7F, 0x81, 0x85, 0x81, 0x6E, 0x81, 0x82, 0x83, 0x7D, 0x7F, 0x81, 0x82, 0x71, 0x7E, 0x82, 0x85, 0x7D, 0x7C, 0x8F, 0x7B, 0x80, 0x87, 0x88, 0x81, 0x79, 0x7B, 0x83, 0x7D, 0x73, 0x80, 0x7F, 0x78, 0x81, 0x7B, 0x7C, 0x86, 0x7E, 0x85, 0x85, 0x84, 0x8B, 0x7D, 0x83, 0x83, 0x80, 0x7B, 0x7C, 0x80, 0x7D, 0x77, 0x7D, 0x7B, 0x7B, 0x74, 0x7A, 0x87, 0x84, 0x80, 0x86, 0x90, 0x7C, 0x84, 0x88, 0x87, 0x74, 0x80, 0x80, 0x73, 0x7C, 0x88, 0x7F, 0x7B, 0x83, 0x73, 0x74, 0x70, 0x8B, 0x8B, 0x7B, 0x8F, 0x92, 0x80, 0x71, 0x7C, 0x85, 0x79, 0x7E, 0x81, 0x89, 0x84, 0x78, 0x80, 0x78, 0x7E, 0x7C, 0x76, 0x8C, 0x8B, 0x7B, 0x81, 0x83, 0x78, 0x78, 0x77, 0x82, 0x8C, 0x83, 0x7F, 0x8B, 0x8A, 0x79, 0x73, 0x79, 0x7B, 0x79, 0x7D, 0x89, 0x8F, 0x78, 0x7D, 0x80, 0x7B, 0x7E, 0x7B, 0x88, 0x8A, 0x84, 0x88, 0x81, 0x79, 0x83, 0x71, 0x75, 0x81, 0x7E, 0x7F, 0x8A, 0x80, 0x7A, 0x81, 0x78, 0x7B, 0x7A, 0x88, 0x88, 0x89, 0x85, 0x89, 0x88, 0x79, 0x74, 0x7F, 0x7A, 0x76, 0x83, 0x7C, 0x84, 0x82, 0x72, 0x72, 0x7C, 0x82, 0x7D, 0x88, 0x91, 0x8E, 0x8B, 0x70, 0x79, 0x85, 0x76, 0x77, 0x85, 0x8F, 0x88, 0x7D, 0x78, 0x81, 0x79, 0x69, 0x7C, 0x81, 0x81, 0x86, 0x7D, 0x8B, 0x83, 0x85, 0x7B, 0x7F, 0x8A, 0x7C, 0x80, 0x83, 0x81, 0x78, 0x7B, 0x79, 0x76, 0x83, 0x81, 0x80, 0x82, 0x8B, 0x7B, 0x7B, 0x84, 0x7C, 0x82, 0x82, 0x8E, 0x82, 0x81, 0x83, 0x79, 0x6E, 0x73, 0x80, 0x79, 0x87, 0x85, 0x80, 0x83, 0x7B, 0x7F, 0x83, 0x82, 0x88, 0x89, 0x8A, 0x80, 0x7B, 0x7D, 0x75, 0x75, 0x78, 0x7E, 0x86, 0x7A, 0x7E, 0x87, 0x82, 0x7A, 0x81, 0x85, 0x83, 0x85, 0x7E, 0x82, 0x83, 0x7C, 0x7C, 0x7D, 0x7E, 0x7D, 0x7A, 0x7E, 0x80, 0x82, 0x79, 0x7D, 0x85, 0x81, 0x83, 0x88, 0x89, 0x85, 0x7D, 0x78, 0x7F, 0x7B, 0x76, 0x7D, 0x8B, 0x89, 0x7A, 0x79, 0x76, 0x7A, 0x77, 0x76, 0x8A, 0x8E, 0x88, 0x7D, 0x7D, 0x81, 0x81, 0x78, 0x7F, 0x86, 0x8E, 0x7E, 0x7C, 0x86, 0x80, 0x7D, 0x6F, 0x7B, 0x81, 0x84, 0x7D, 0x82, 0x88, 0x83, 0x75, 0x76, 0x80, 0x7E, 0x7B, 0x7D, 0x88, 0x89, 0x84, 0x82, 0x7D, 0x7E, 0x81, 0x79, 0x7E, 0x85, 0x84, 0x7C, 0x7B, 0x7D, 0x7F, 0x79, 0x83, 0x7F, 0x84, 0x84, 0x7C, 0x83, 0x80, 0x7C, 0x7C, 0x84, 0x7A, 0x81, 0x7E, 0x86, 0x82, 0x7B, 0x7E, 0x79, 0x7A, 0x7C, 0x7F, 0x80, 0x85, 0x86, 0x87, 0x83, 0x83, 0x82, 0x7E, 0x7F, 0x7D, 0x7E, 0x7D, 0x81, 0x7A, 0x7A, 0x7B, 0x7C, 0x7D, 0x7B, 0x85, 0x82, 0x85, 0x81, 0x86, 0x82, 0x81, 0x7C, 0x82, 0x82, 0x80, 0x80, 0x7F, 0x81, 0x79, 0x7E, 0x7A, 0x83, 0x7E, 0x7E, 0x82, 0x80, 0x7F, 0x80, 0x80, 0x7D, 0x81, 0x7D, 0x7F, 0x7E, 0x87, 0x7C, 0x7F, 0x84, 0x7F, 0x81, 0x7A, 0x84, 0x7B, 0x82, 0x7F, 0x80, 0x82, 0x7E, 0x7C, 0x81, 0x81, 0x7B, 0x85, 0x7E, 0x82, 0x7A, 0x81, 0x80, 0x7E, 0x7D, 0x82, 0x80, 0x7F, 0x81, 0x7F, 0x85, 0x7A, 0x85, 0x7B, 0x80, 0x82, 0x7E, 0x84, 0x81, 0x81, 0x7E, 0x80, 0x7C, 0x7E, 0x7C, 0x82, 0x7F, 0x7C, 0x7F, 0x7E, 0x7F, 0x81, 0x7E, 0x86, 0x85, 0x7D, 0x82, 0x7F, 0x85, 0x7D, 0x7E, 0x80, 0x83, 0x7B, 0x7A, 0x82, 0x7F, 0x7F, 0x7C, 0x7E, 0x7D, 0x7F, 0x7D, 0x7D, 0x87, 0x7F, 0x84, 0x83, 0x82, 0x81, 0x7C, 0x81, 0x7F, 0x82, 0x7D, 0x82, 0x7D, 0x81, 0x7B, 0x7F, 0x7E, 0x7D, 0x7D, 0x7D, 0x81, 0x82, 0x7F, 0x81, 0x83, 0x7F, 0x81, 0x7F, 0x87, 0x80, 0x80, 0x7C, 0x83, 0x7E, 0x7C, 0x7D, 0x7E, 0x80, 0x7E, 0x7F, 0x7F, 0x80, 0x7E, 0x82, 0x7E, 0x7F, 0x84, 0x7F, 0x80, 0x86, 0x7E, 0x7F, 0x7F, 0x7D, 0x80, 0x7C, 0x7D, 0x81, 0x7F, 0x80, 0x7F, 0x83, 0x83, 0x81, 0x80, 0x81, 0x7D, 0x83, 0x7E, 0x7D, 0x7E, 0x79, 0x7E, 0x7B, 0x7F, 0x7C, 0x83, 0x81, 0x83, 0x84, 0x85, 0x81, 0x84, 0x82, 0x80, 0x82, 0x7A, 0x7C, 0x7B, 0x7C, 0x7D, 0x7C, 0x7F, 0x7F, 0x77, 0x81, 0x80, 0x81, 0x83, 0x84, 0x86, 0x83, 0x82, 0x86, 0x84, 0x80, 0x7C, 0x7B, 0x7C, 0x7A, 0x7A, 0x7D, 0x7E, 0x7E, 0x7D, 0x79, 0x83, 0x80, 0x85, 0x88, 0x80, 0x87, 0x83, 0x79, 0x7D, 0x82, 0x80, 0x7C, 0x80, 0x7E, 0x7F, 0x78, 0x7B, 0x81, 0x7E, 0x80, 0x80, 0x86, 0x83, 0x82, 0x84, 0x83, 0x82, 0x7E, 0x7C, 0x7D, 0x7B, 0x7E, 0x7B, 0x80, 0x7D, 0x7F, 0x7C, 0x7E, 0x7F, 0x7F, 0x84, 0x7F, 0x84, 0x81, 0x81, 0x7E, 0x80, 0x88, 0x82, 0x82, 0x82, 0x7C, 0x7D, 0x79, 0x7C, 0x7B, 0x82, 0x7C, 0x7F, 0x81, 0x7E, 0x7F, 0x7F, 0x7F, 0x81, 0x82, 0x81, 0x86, 0x80, 0x82, 0x7D, 0x7D, 0x7F, 0x7F, 0x81, 0x81, 0x7F, 0x7E, 0x7B, 0x7C, 0x80, 0x7C, 0x81, 0x83, 0x82, 0x83, 0x82, 0x7F, 0x82, 0x80, 0x7B, 0x7E, 0x7E, 0x83, 0x7D, 0x7F, 0x81, 0x7C, 0x7D, 0x7D, 0x81, 0x7F, 0x82, 0x81, 0x83, 0x7D, 0x7F, 0x82, 0x80, 0x7E, 0x85, 0x81, 0x7E, 0x7C, 0x7F, 0x80, 0x80, 0x7E, 0x7F, 0x82, 0x7E, 0x81, 0x7E, 0x81, 0x7E, 0x7F, 0x7E, 0x7C, 0x7F, 0x80, 0x7E, 0x86, 0x83};
-	
-#endif /* AUDIOARRAYS_H_ */
\ No newline at end of file
+const uint8_t youLose[] = {0xFF, 0xFF, 0xE2, 0x03, 0x68, 0x3B, 0x08, 0x79, 0x2F, 0x19, 0x2C, 0xB1, 0x21, 0x08, 0xA8, 0x95, 0xC1, 0xF4, 0xB0, 0xC7, 0xA6, 0x14, 0x6C, 0x9B, 0xC2, 0x3A, 0x1D, 0x82, 0x40, 0xB0, 0xA7, 0x10, 0x89, 0xB3, 0x38, 0x8E, 0xB1, 0x49, 0x8B, 0xA3, 0x48, 0x09, 0xA4, 0x41, 0x0A, 0xA4, 0x03, 0xB1, 0xC2, 0x1C, 0x0E, 0x8A, 0x19, 0x6B, 0x3C, 0xA0, 0x85, 0x00, 0xC3, 0x84, 0x29, 0xA0, 0x92, 0x2C, 0xCA, 0xA1, 0x3B, 0x9B, 0x11, 0x4E, 0xA0, 0x85, 0x38, 0x00, 0x03, 0x40, 0xC1, 0x92, 0x1F, 0xBA, 0xA0, 0x2B, 0x99, 0x83, 0x84, 0xA7, 0x32, 0x3A, 0x08, 0x49, 0x1B, 0x80, 0x2B, 0xAB, 0x0C, 0x0F, 0xB0, 0x21, 0x8E, 0xD7, 0x93, 0x18, 0x00, 0x21, 0x39, 0x88, 0x80, 0x2E, 0x8C, 0x09, 0x5D, 0x1B, 0x90, 0x11, 0xC1, 0xB7, 0xA4, 0x81, 0x19, 0x08, 0x4A, 0x1B, 0xB2, 0x01, 0x3B, 0x3B, 0x4C, 0x1C, 0xC0, 0xB3, 0xA2, 0xA2, 0x63, 0x7B, 0x19, 0xA0, 0x90, 0x2A, 0x89, 0xA1, 0xB1, 0x80, 0xD0, 0xA7, 0x12, 0x98, 0x93, 0x4A, 0x8C, 0xC5, 0x20, 0x3B, 0x19, 0x18, 0x4C, 0xA8, 0xB3, 0x69, 0x3F, 0x8A, 0x08, 0x98, 0xA6, 0x93, 0x92, 0x81, 0x18, 0x1C, 0xA9, 0xE1, 0xC5, 0x92, 0x81, 0x38, 0x4C, 0x4B, 0x2A, 0x1A, 0x89, 0x80, 0x1A, 0x08, 0x49, 0x19, 0xE4, 0xB6, 0xB3, 0xB3, 0x00, 0x8A, 0x19, 0x3A, 0x7D, 0x2A, 0x38, 0x2B, 0x88, 0xF1, 0xB3, 0x80, 0xA0, 0xA3, 0x78, 0x3C, 0x19, 0x4A, 0x8A, 0x91, 0x80, 0xD0, 0xB5, 0x10, 0x98, 0xD7, 0x83, 0x5A, 0x1B, 0x80, 0x08, 0x89, 0xA2, 0x4A, 0x8A, 0xA4, 0x40, 0x89, 0xD4, 0xA3, 0xA0, 0xA2, 0x59, 0x3D, 0x1A, 0x80, 0x79, 0x2C, 0x88, 0x91, 0xA0, 0xC4, 0x01, 0x89, 0xC3, 0x93, 0x10, 0x08, 0x28, 0x09, 0x90, 0x2C, 0x1E, 0x8A, 0x10, 0x79, 0x4B, 0x80, 0x81, 0xD1, 0xB4, 0x39, 0xBA, 0xB6, 0x20, 0x2A, 0xA0, 0xC7, 0x93, 0x39, 0x2B, 0x3B, 0x2D, 0x89, 0x20, 0x2B, 0xF5, 0x03, 0x4D, 0xA9, 0xB5, 0x38, 0x9B, 0xC4, 0x20, 0x1B, 0xB3, 0x32, 0x0B, 0xB5, 0x48, 0x1E, 0xA8, 0x82, 0x98, 0x22, 0x5F, 0x9A, 0xB5, 0x11, 0x8A, 0xB2, 0x18, 0xB9, 0xA6, 0x20, 0x88, 0x70, 0x3D, 0xA8, 0x93, 0x4C, 0x9A, 0xB3, 0x28, 0x99, 0xA7, 0x11, 0x88, 0xB3, 0x10, 0x2C, 0x2D, 0x1B, 0x90, 0x10, 0xC1, 0x86, 0x6A, 0x0A, 0x91, 0x29, 0x8B, 0xB2, 0x28, 0xD0, 0x96, 0x18, 0xD3, 0x31, 0x2D, 0xB0, 0x20, 0x1E, 0xA0, 0x20, 0x8A, 0x96, 0x20, 0x1A, 0xE2, 0xA3, 0x4A, 0x0C, 0xA1, 0x20, 0x2B, 0xA1, 0x84, 0x20, 0x89, 0x01, 0x1D, 0xB8, 0x29, 0x0D, 0x80, 0x11, 0x21, 0x79, 0xE0, 0xB7, 0x21, 0x0C, 0xB2, 0x49, 0x0C, 0x91, 0x38, 0x1A, 0x93, 0x91, 0xC5, 0x58, 0x0D, 0xC2, 0x30, 0x1D, 0xB2, 0x31, 0x0A, 0xA3, 0x81, 0x91, 0x3B, 0xFA, 0xA3, 0x4D, 0x8A, 0x93, 0x7A, 0x89, 0x82, 0x88, 0xB3, 0x20, 0xF0, 0x82, 0x2C, 0xB8, 0x21, 0x2B, 0x93, 0x78, 0x89, 0x82, 0x0B, 0xF4, 0x01, 0x0B, 0xA1, 0x21, 0x1A, 0x13, 0x59, 0x89, 0x92, 0x2B, 0xCB, 0x88, 0x9B, 0x10, 0x0C, 0x06, 0x48, 0xA3, 0x41, 0xE9, 0xA7, 0x38, 0x8C, 0xA2, 0x5B, 0x8B, 0x92, 0x28, 0x28, 0xB3, 0x05, 0x2A, 0xE0, 0x11, 0x1F, 0xE2, 0x11, 0x8A, 0x83, 0x00, 0x30, 0x0B, 0xB5, 0x38, 0x9C, 0x90, 0x98, 0x38, 0x0E, 0x93, 0x6A, 0xC1, 0x84, 0x29, 0x98, 0x38, 0xAA, 0xA6, 0x09, 0xC1, 0xA0, 0x00, 0x2A, 0x48, 0x68, 0x28, 0x08, 0xB1, 0x98, 0xF1, 0x08, 0x8A, 0x09, 0xA2, 0x72, 0x28, 0x81, 0x10, 0x3A, 0x8E, 0xC1, 0xA8, 0x00, 0x1B, 0xB4, 0x41, 0x1A, 0x84, 0x01, 0xA5, 0x39, 0xC8, 0x7B, 0x0A, 0x90, 0x90, 0x2B, 0xCB, 0x91, 0x92, 0x64, 0x01, 0x33, 0xD8, 0x12, 0x9F, 0x91, 0x8A, 0x1A, 0x09, 0x20, 0x41, 0x23, 0x15, 0xB0, 0x80, 0xCB, 0x9C, 0xF0, 0x28, 0x88, 0x03, 0x68, 0x19, 0xB0, 0x94, 0x2B, 0xB3, 0xE2, 0x40, 0xA9, 0x22, 0x2B, 0x0A, 0xB8, 0xC9, 0x0F, 0xB0, 0x84, 0x53, 0x10, 0x41, 0xA0, 0xA1, 0xBA, 0x0F, 0x8A, 0xB8, 0x00, 0x19, 0x71, 0x51, 0x92, 0x13, 0x9B, 0xB9, 0xF0, 0xA8, 0x89, 0x80, 0x43, 0x50, 0x19, 0xC3, 0x38, 0x0D, 0xF1, 0x11, 0x09, 0x80, 0x11, 0x89, 0xA2, 0xA4, 0x3A, 0x0E, 0xC9, 0x80, 0x4A, 0x80, 0x15, 0x11, 0x03, 0x91, 0x1C, 0xAC, 0xDA, 0x3A, 0xCA, 0x88, 0x68, 0x81, 0x17, 0x10, 0x98, 0xA1, 0xB0, 0xDA, 0x08, 0x2C, 0x2B, 0x13, 0x70, 0x08, 0xB3, 0x91, 0x0B, 0xF9, 0x81, 0x5B, 0x80, 0x04, 0x1A, 0xB3, 0x89, 0x2D, 0xB2, 0x98, 0x1D, 0x99, 0x80, 0x52, 0x22, 0x92, 0x86, 0x82, 0x89, 0xD0, 0xC8, 0x1E, 0x90, 0xA0, 0x2B, 0x38, 0x33, 0x15, 0x06, 0x00, 0xB0, 0xA0, 0x0F, 0x8C, 0x98, 0x18, 0x13, 0x84, 0x08, 0x32, 0x92, 0x9A, 0xBC, 0xD9, 0xA0, 0x40, 0x01, 0x24, 0x4E, 0x08, 0xA0, 0x0B, 0x01, 0x04, 0xFA, 0xA1, 0x9A, 0xB4, 0x79, 0x29, 0x92, 0x42, 0x4A, 0xB0, 0xC1, 0x8A, 0x8A, 0xD0, 0x0A, 0x1A, 0x12, 0x24, 0x45, 0x02, 0x01, 0xBA, 0xCA, 0x8D, 0xAA, 0x09, 0x40, 0x84, 0x03, 0x5A, 0xA3, 0xA3, 0xAC, 0x89, 0x1B, 0x1F, 0x81, 0x52, 0x18, 0x00, 0xD8, 0xC1, 0x30, 0x81, 0xE1, 0x99, 0x1B, 0x00, 0x18, 0x70, 0x22, 0x92, 0x21, 0x02, 0xDA, 0xDE, 0x80, 0x28, 0xAB, 0xB8, 0x51, 0x21, 0x86, 0x14, 0x18, 0xA9, 0xA9, 0x0B, 0x9D, 0x0B, 0x18, 0x16, 0x01, 0x98, 0x94, 0x14, 0x0A, 0xEA, 0x80, 0x2B, 0x0A, 0x41, 0x22, 0x01, 0xE1, 0xB3, 0x8B, 0x9C, 0x85, 0x32, 0x0D, 0x0C, 0x19, 0x91, 0x08, 0x33, 0x07, 0xB1, 0x22, 0x20, 0xF9, 0xBA, 0x19, 0x80, 0xAE, 0x8C, 0x31, 0x72, 0x01, 0x84, 0x02, 0x99, 0xBA, 0x9A, 0xAC, 0x8C, 0x10, 0x07, 0x92, 0x1A, 0x50, 0x11, 0xC0, 0x89, 0x2E, 0x8A, 0x90, 0x12, 0x32, 0x91, 0xD4, 0x80, 0x1A, 0x91, 0x95, 0xC8, 0xBA, 0x9A, 0x82, 0x78, 0x50, 0x02, 0x31, 0x19, 0xC3, 0xAB, 0xAE, 0x8A, 0xA1, 0xBA, 0x8B, 0x72, 0x16, 0x22, 0x81, 0x01, 0xB9, 0x8D, 0xCB, 0x81, 0x0E, 0x80, 0x12, 0x24, 0x19, 0x82, 0x2A, 0xD9, 0xAA, 0xA8, 0x5A, 0x88, 0x34, 0x03, 0x81, 0xEB, 0x38, 0x20, 0x95, 0x9F, 0xAA, 0x8A, 0x82, 0x68, 0x31, 0x14, 0x23, 0x19, 0xF4, 0x89, 0xBC, 0x81, 0x88, 0x8A, 0x8A, 0x73, 0x32, 0x23, 0x19, 0x91, 0x9A, 0xBD, 0x9D, 0x90, 0x2B, 0xC0, 0x06, 0x03, 0x82, 0x81, 0x5B, 0x0B, 0xF9, 0x18, 0x09, 0x00, 0x31, 0x82, 0x20, 0xAA, 0x2A, 0x05, 0x98, 0xFE, 0xA8, 0x2B, 0x18, 0x14, 0x43, 0x21, 0x40, 0x20, 0xF0, 0xC9, 0x0A, 0x1B, 0xC1, 0xA0, 0x2A, 0x43, 0x23, 0x42, 0x82, 0x23, 0x3D, 0x9F, 0xC1, 0x90, 0x8A, 0x88, 0x81, 0x23, 0x85, 0x28, 0x5B, 0x99, 0x10, 0x0B, 0x2B, 0x7A, 0xB1, 0xA6, 0x00, 0x1D, 0x81, 0x81, 0x92, 0xD9, 0x8D, 0x1A, 0x91, 0x34, 0x30, 0x00, 0x07, 0x12, 0x0A, 0xDC, 0x99, 0x4B, 0x89, 0x9A, 0x8B, 0x32, 0x55, 0x82, 0x83, 0x01, 0x00, 0xA8, 0xDB, 0xDB, 0x0A, 0x8A, 0x82, 0x48, 0x94, 0x42, 0x29, 0xA5, 0x08, 0x8C, 0x82, 0x5B, 0x9B, 0x21, 0x0A, 0xF4, 0x10, 0x30, 0x93, 0xD2, 0xDB, 0xAB, 0x18, 0x21, 0x41, 0x68, 0x04, 0x23, 0x88, 0xF8, 0xA9, 0x0C, 0x08, 0x90, 0xC9, 0x91, 0x24, 0x24, 0x00, 0x81, 0x22, 0x3D, 0xA9, 0x89, 0xAF, 0xD2, 0x18, 0x09, 0x02, 0x39, 0xA2, 0x17, 0x18, 0xD0, 0x00, 0x0A, 0xA8, 0x29, 0x4D, 0x91, 0x02, 0x8A, 0x73, 0x28, 0x90, 0xCE, 0xA9, 0x09, 0x01, 0x12, 0x16, 0x32, 0x22, 0x11, 0xDB, 0xAD, 0xAB, 0x01, 0xA8, 0x9B, 0xAA, 0x36, 0x44, 0x12, 0x28, 0x10, 0x91, 0xB8, 0xAC, 0xAD, 0xBB, 0xB0, 0x7A, 0x09, 0x03, 0x41, 0x42, 0x82, 0x3C, 0x9E, 0xA2, 0x89, 0x99, 0x11, 0x05, 0xA0, 0x02, 0x71, 0x03, 0xA9, 0xDF, 0x8A, 0x89, 0x31, 0x11, 0x15, 0x62, 0x20, 0xB0, 0xC8, 0x9B, 0x99, 0xB0, 0x99, 0x9C, 0x00, 0x36, 0x53, 0x10, 0x01, 0x18, 0x89, 0xD9, 0x8A, 0x8D, 0xB9, 0x81, 0x28, 0x70, 0x81, 0xA4, 0x11, 0x09, 0x89, 0xA9, 0xCA, 0x81, 0x54, 0x00, 0xB0, 0x00, 0x56, 0x28, 0xDB, 0xDB, 0x8B, 0x80, 0x32, 0x38, 0x27, 0x42, 0x02, 0xA8, 0xBD, 0xB8, 0x00, 0x8D, 0xBA, 0x18, 0x20, 0x26, 0x51, 0x11, 0x81, 0x01, 0x8B, 0xBB, 0xBE, 0xB9, 0x80, 0x82, 0x70, 0x90, 0x97, 0x20, 0x2A, 0x19, 0xBA, 0xC0, 0x40, 0x29, 0x00, 0xD2, 0x31, 0x22, 0x41, 0xEE, 0xB9, 0x8A, 0x11, 0x10, 0x04, 0x63, 0x33, 0x10, 0xC9, 0x9B, 0xCA, 0x89, 0xAD, 0x89, 0x09, 0x43, 0x32, 0x17, 0x11, 0x01, 0x89, 0xB8, 0xBC, 0xBB, 0x2D, 0x01, 0x12, 0xE0, 0x18, 0x38, 0x12, 0xC8, 0x1A, 0x68, 0x33, 0xAA, 0x90, 0x28, 0x07, 0x08, 0xD0, 0xCC, 0xAC, 0x1A, 0x12, 0x52, 0x80, 0x27, 0x22, 0x08, 0xCB, 0x99, 0xA9, 0xBA, 0x8F, 0x09, 0x01, 0x15, 0x20, 0x04, 0x22, 0x18, 0xA9, 0x8D, 0xFB, 0x90, 0x29, 0x3A, 0x18, 0x82, 0x10, 0x53, 0x9B, 0xE9, 0x92, 0x23, 0x10, 0x8C, 0x18, 0x07, 0x31, 0x9A, 0xED, 0xB9, 0x18, 0x3A, 0x10, 0x11, 0x75, 0x12, 0x18, 0x8B, 0xB9, 0xB1, 0xFA, 0x9B, 0x08, 0x10, 0x04, 0x63, 0x10, 0x01, 0x80, 0x90, 0xB9, 0xAF, 0xA8, 0x01, 0x81, 0x48, 0x19, 0x93, 0x04, 0x0F, 0x00, 0x08, 0x11, 0xCA, 0x32, 0x74, 0x80, 0xB0, 0xCB, 0x8C, 0xB8, 0x90, 0x81, 0x25, 0x64, 0x21, 0x80, 0x89, 0x99, 0xB9, 0xCE, 0xA8, 0x19, 0x81, 0x05, 0x43, 0x10, 0x02, 0x99, 0xB9, 0x3B, 0xAD, 0xA0, 0xB1, 0x12, 0x0E, 0x10, 0xC3, 0x51, 0x38, 0x03, 0xCD, 0x18, 0x72, 0x00, 0xD1, 0xB8, 0x9B, 0xA8, 0x91, 0x21, 0x46, 0x78, 0x00, 0xA3, 0x88, 0x8B, 0xA9, 0xEB, 0x99, 0x3C, 0x98, 0x16, 0x41, 0x10, 0x29, 0xB9, 0xC2, 0x2A, 0xCA, 0x82, 0x98, 0x91, 0x64, 0xAA, 0xC1, 0x81, 0x41, 0x0B, 0x0A, 0x17, 0x59, 0x18, 0xA9, 0xDC, 0x08, 0x89, 0x10, 0x52, 0x21, 0x01, 0x95, 0x88, 0x0C, 0xB9, 0xDA, 0xA8, 0x3A, 0x22, 0x04, 0x26, 0x20, 0x0B, 0xAA, 0xC8, 0x2B, 0xCA, 0x04, 0x21, 0x05, 0x99, 0xB8, 0x99, 0x7B, 0x08, 0xA0, 0x40, 0x40, 0x08, 0xB3, 0xDB, 0xAD, 0x99, 0x3A, 0x24, 0x07, 0x31, 0x39, 0xA0, 0xE1, 0x98, 0xBC, 0x99, 0x98, 0x50, 0x20, 0x24, 0x05, 0x88, 0x9A, 0xC9, 0x91, 0x89, 0x2A, 0x04, 0x79, 0x90, 0x81, 0xBA, 0x99, 0xA6, 0x92, 0x5B, 0x80, 0x14, 0x20, 0x9B, 0xAD, 0x8D, 0xF1, 0x21, 0x20, 0x11, 0x93, 0x00, 0x10, 0x8E, 0xC8, 0xAA, 0x09, 0x0B, 0x24, 0x23, 0x71, 0x92, 0x91, 0xA8, 0x9B, 0xAB, 0xF0, 0x84, 0x38, 0x58, 0xA8, 0x01, 0x0C, 0x1C, 0xB2, 0xA2, 0x50, 0x80, 0x05, 0x91, 0x9B, 0xAC, 0x3D, 0x8D, 0x93, 0x04, 0x61, 0x08, 0xA2, 0x91, 0x8A, 0xAC, 0xBA, 0xB8, 0x10, 0x43, 0x63, 0x24, 0x80, 0xB0, 0xBA, 0x0C, 0xD8, 0x18, 0x40, 0x1A, 0x17, 0x2B, 0x99, 0xD0, 0x5A, 0x88, 0xA0, 0x94, 0x38, 0x11, 0xC3, 0x98, 0x9D, 0x4E, 0xAB, 0xA4, 0x23, 0x58, 0x80, 0x92, 0x80, 0x8A, 0xEA, 0x99, 0x8A, 0x3A, 0x01, 0x64, 0x40, 0x00, 0xB0, 0xB1, 0x1A, 0xDC, 0x90, 0x22, 0x1A, 0x17, 0x2C, 0x08, 0xB0, 0x3A, 0x19, 0xAA, 0x04, 0x1A, 0x54, 0xB1, 0x01, 0xAD, 0x2D, 0xE9, 0x93, 0x30, 0x38, 0x84, 0x83, 0x3A, 0x8C, 0xDA, 0x98, 0x0E, 0x99, 0x83, 0x31, 0x24, 0x04, 0x92, 0xAA, 0x8B, 0x8D, 0xBA, 0x31, 0x4F, 0x81, 0x03, 0x98, 0xB0, 0x90, 0x0A, 0xA2, 0xE0, 0x79, 0x10, 0x10, 0x22, 0x8D, 0x8A, 0x9F, 0xE2, 0x82, 0x18, 0x22, 0x83, 0x23, 0x9A, 0x0B, 0xCB, 0x8F, 0x0A, 0x8C, 0x21, 0x40, 0x41, 0x84, 0x80, 0xA1, 0xAB, 0xC8, 0xC8, 0x19, 0x88, 0x43, 0x16, 0x18, 0xB1, 0x9B, 0x08, 0x8C, 0x2A, 0x0E, 0x59, 0x13, 0x11, 0x03, 0xD9, 0x9A, 0xBC, 0x2E, 0xC9, 0x97, 0x12, 0x10, 0xA2, 0x01, 0x2A, 0x9E, 0xA0, 0x9A, 0x2D, 0x80, 0x12, 0x34, 0x10, 0x83, 0xD0, 0xC8, 0x90, 0x0C, 0x89, 0x82, 0x24, 0x7A, 0x80, 0xA8, 0xB1, 0x09, 0xA0, 0xC6, 0x08, 0x18, 0x93, 0x54, 0x29, 0x98, 0xC8, 0x1D, 0x0C, 0x2B, 0x89, 0x07, 0x13, 0x10, 0xA1, 0xB0, 0xA1, 0x9E, 0xBB, 0x1B, 0x6B, 0x10, 0x70, 0x02, 0x92, 0x18, 0xD9, 0xC0, 0x09, 0x1A, 0x88, 0x33, 0x70, 0x19, 0xA2, 0xB1, 0x1B, 0xFA, 0xC1, 0x93, 0x69, 0x09, 0x83, 0x69, 0x19, 0xA0, 0x91, 0xCB, 0xA8, 0xD0, 0x81, 0x30, 0x33, 0x26, 0x59, 0xC8, 0xB4, 0x2A, 0x9C, 0xC0, 0x00, 0x39, 0x80, 0x15, 0x12, 0x00, 0xB0, 0xD2, 0x8B, 0x9B, 0x99, 0x59, 0x79, 0x00, 0x01, 0x81, 0x99, 0xE1, 0xB1, 0x89, 0x91, 0x93, 0x71, 0x18, 0x3A, 0x3B, 0x43, 0x0B, 0xF1, 0xB0, 0x9A, 0xD9, 0xA0, 0x30, 0x64, 0x31, 0x00, 0x01, 0xAB, 0xE4, 0x88, 0x8D, 0xA9, 0x80, 0x50, 0x20, 0x21, 0x23, 0x00, 0x0C, 0xF9, 0xC0, 0x88, 0x80, 0x00, 0x31, 0x32, 0x3A, 0x08, 0x1C, 0x0F, 0xAA, 0xB3, 0x12, 0x29, 0x01, 0x87, 0x82, 0x0D, 0x3A, 0x83, 0xB2, 0x10, 0x8B, 0xCD, 0xAD, 0xBA, 0x10, 0x74, 0x32, 0x82, 0x84, 0x18, 0x8C, 0xAA, 0xEB, 0xB9, 0x1B, 0x30, 0x13, 0x46, 0x13, 0x81, 0x98, 0xE8, 0xE0, 0x09, 0x2A, 0x88, 0x12, 0x61, 0x08, 0x80, 0x98, 0x9A, 0xA9, 0xB9, 0x16, 0x31, 0x9B, 0x85, 0x13, 0x2E, 0xC9, 0x90, 0x23, 0x3B, 0x10, 0x92, 0x9D, 0xEA, 0xBA, 0x0B, 0x60, 0x70, 0x12, 0x11, 0x18, 0x89, 0xC8, 0xAB, 0xCD, 0x8A, 0x88, 0x21, 0x42, 0x36, 0x12, 0x00, 0xA9, 0xCA, 0x9F, 0x88, 0x0A, 0x13, 0x40, 0xB7, 0x02, 0x08, 0x8B, 0xA0, 0x08, 0x8D, 0x58, 0x83, 0x00, 0x2D, 0x01, 0xD1, 0x98, 0x3B, 0xA3, 0xA1, 0x15, 0x68, 0x99, 0xB8, 0xB8, 0x8D, 0x0B, 0x41, 0x14, 0x24, 0x02, 0x81, 0x09, 0x09, 0xFC, 0xAC, 0x0C, 0x00, 0x08, 0x23, 0x54, 0x22, 0x08, 0xF1, 0x90, 0x8B, 0x8A, 0xB0, 0x21, 0x62, 0x11, 0x38, 0x98, 0xD1, 0xB9, 0x8B, 0xD8, 0x81, 0x44, 0x13, 0x88, 0x18, 0x39, 0xEC, 0x09, 0x48, 0x1C, 0xF1, 0x84, 0x10, 0x8A, 0xB0, 0xB3, 0x1C, 0x3C, 0x11, 0x24, 0x59, 0x08, 0xA0, 0x08, 0x08, 0xFC, 0xA8, 0x09, 0x18, 0x18, 0x13, 0x27, 0x21, 0x89, 0x88, 0xD9, 0xC9, 0x0A, 0x2A, 0x03, 0x05, 0x01, 0x59, 0x8A, 0xC8, 0xA0, 0x18, 0xAA, 0x50, 0x07, 0xA0, 0x09, 0x30, 0x90, 0xAA, 0x4B, 0x21, 0xD8, 0x80, 0x31, 0xE8, 0xB0, 0x08, 0x9E, 0x98, 0x41, 0x63, 0x32, 0x11, 0xA0, 0xDA, 0x89, 0xA0, 0xCD, 0x8B, 0x88, 0x10, 0x31, 0x73, 0x13, 0x33, 0x32, 0xCB, 0xFB, 0xA9, 0xB8, 0x8B, 0x59, 0x06, 0x30, 0x89, 0x81, 0x90, 0xAE, 0xB3, 0x80, 0x2D, 0x40, 0x13, 0x18, 0x1E, 0x82, 0xB1, 0xBA, 0x1C, 0x91, 0x9A, 0xB7, 0x85, 0x20, 0x39, 0xCA, 0xA8, 0x6B, 0x2B, 0x98, 0x44, 0x21, 0x88, 0x9A, 0x94, 0xB2, 0xCA, 0x9F, 0xA8, 0x90, 0x40, 0x28, 0x02, 0x37, 0x21, 0x98, 0xD9, 0x89, 0x9D, 0x99, 0x00, 0x34, 0x20, 0x91, 0x82, 0xC0, 0x9C, 0x0A, 0xA0, 0xF3, 0x40, 0x41, 0x81, 0xA0, 0x11, 0x08, 0x9D, 0x9F, 0x80, 0x92, 0x00, 0x11, 0x06, 0x01, 0xCA, 0x08, 0x1C, 0x9B, 0x00, 0x75, 0x10, 0x80, 0x98, 0x80, 0x80, 0xAA, 0xCD, 0xA9, 0x0A, 0x11, 0x05, 0x15, 0x69, 0x11, 0x82, 0xB9, 0x1E, 0x8B, 0xBA, 0xA1, 0x63, 0x02, 0xA2, 0x92, 0x20, 0xAD, 0xAB, 0x39, 0x68, 0x2D, 0x91, 0x07, 0x00, 0x99, 0x80, 0xB2, 0xB9, 0x0E, 0x19, 0x92, 0x11, 0x79, 0x20, 0xA2, 0xA9, 0x8C, 0xB8, 0xB2, 0x01, 0x74, 0x12, 0xB2, 0x80, 0x3C, 0x88, 0xE8, 0x8C, 0x8B, 0x09, 0x28, 0x33, 0x33, 0x17, 0x15, 0x01, 0xAB, 0xEC, 0xA0, 0x09, 0x2A, 0x11, 0x35, 0x39, 0x2B, 0xB8, 0xF1, 0x99, 0x1A, 0x00, 0xB2, 0x26, 0x52, 0x19, 0xA8, 0xA0, 0x08, 0x9D, 0xBC, 0x18, 0x81, 0x25, 0x38, 0x42, 0x11, 0xEB, 0xB9, 0x0A, 0x8B, 0x94, 0x05, 0x36, 0x29, 0xB8, 0xB1, 0x58, 0x8D, 0xC9, 0xA9, 0x98, 0x40, 0x13, 0x32, 0x32, 0x35, 0xC3, 0x8B, 0x9F, 0x89, 0xAA, 0x80, 0x31, 0x17, 0x80, 0x91, 0x90, 0x90, 0x0F, 0xA8, 0x80, 0x84, 0x71, 0x29, 0x81, 0xB1, 0x2B, 0x8D, 0xA1, 0xCA, 0x88, 0x40, 0x13, 0xD2, 0x31, 0x50, 0x80, 0xA9, 0xC9, 0x8B, 0xAB, 0x39, 0x25, 0x42, 0x31, 0x13, 0xA1, 0x81, 0xCD, 0xF1, 0xDB, 0x9A, 0x00, 0x04, 0x42, 0x48, 0x41, 0x82, 0x8A, 0x9C, 0xBA, 0xD9, 0x98, 0x11, 0x85, 0xA6, 0x11, 0x48, 0x0B, 0xBA, 0x28, 0x4C, 0x8A, 0xB4, 0x04, 0x21, 0x90, 0xE2, 0x90, 0x2A, 0x0F, 0x99, 0x12, 0x40, 0x18, 0xA9, 0x02, 0x84, 0x92, 0x8A, 0xE8, 0xA8, 0x2B, 0x2C, 0x10, 0x78, 0x11, 0x02, 0x08, 0x5A, 0xE8, 0xF3, 0xA0, 0x09, 0x29, 0x82, 0x82, 0x78, 0x38, 0x90, 0xA0, 0x1A, 0x8C, 0xBA, 0x82, 0x10, 0x98, 0x05, 0x15, 0x11, 0x9D, 0xA1, 0x91, 0x1F, 0x1A, 0x01, 0x92, 0x44, 0x20, 0xAB, 0xE0, 0xA1, 0x99, 0xCA, 0x86, 0x40, 0x2C, 0x98, 0x02, 0x32, 0x2B, 0xE0, 0xD1, 0x08, 0x1B, 0xB0, 0x86, 0x30, 0x3A, 0x82, 0xA3, 0x29, 0x1A, 0xAF, 0xEC, 0x80, 0x28, 0x00, 0x03, 0x25, 0x31, 0x09, 0xBA, 0xBB, 0x9E, 0x9A, 0x39, 0x21, 0x60, 0xB4, 0x97, 0x81, 0x0A, 0xAB, 0xC2, 0x32, 0x5D, 0x0A, 0x91, 0x14, 0x3A, 0x8C, 0xB1, 0xA1, 0x9B, 0x0A, 0x84, 0x87, 0x29, 0x00, 0x92, 0x22, 0x0A, 0x8D, 0xD0, 0x99, 0x1B, 0x19, 0x94, 0x04, 0x78, 0x10, 0xA2, 0x03, 0x49, 0xBD, 0xCC, 0x89, 0x09, 0x10, 0x24, 0x34, 0x22, 0x22, 0xCA, 0xAC, 0xAB, 0xBC, 0x18, 0x20, 0x03, 0x17, 0x32, 0x81, 0xAB, 0xBC, 0xAA, 0x98, 0x79, 0x09, 0x42, 0x34, 0x91, 0xB0, 0xD0, 0xEA, 0xD9, 0xB4, 0x79, 0x3A, 0x08, 0x91, 0x20, 0x3A, 0xA8, 0xE3, 0xA1, 0x0B, 0x99, 0xD2, 0x22, 0x48, 0x00, 0x04, 0x21, 0x5B, 0x1B, 0xD0, 0xBC, 0x0C, 0x98, 0xA2, 0x06, 0x33, 0x40, 0x01, 0xB0, 0xAA, 0x1C, 0xAE, 0x99, 0x02, 0x40, 0x10, 0x03, 0x86, 0x18, 0x9C, 0xE8, 0x80, 0x49, 0x1A, 0x01, 0x03, 0x22, 0x19, 0xB9, 0x8E, 0xCB, 0xB0, 0x08, 0x40, 0x32, 0x15, 0x09, 0xD4, 0x14, 0x1A, 0x9B, 0xF0, 0x09, 0x2A, 0x1B, 0x83, 0x32, 0x54, 0x79, 0x89, 0xD3, 0x91, 0xA9, 0x8B, 0x1B, 0x89, 0x43, 0x42, 0x58, 0x02, 0xA2, 0xD1, 0xAA, 0xC8, 0xE1, 0x95, 0x6C, 0x09, 0x80, 0xA2, 0x38, 0x1B, 0x99, 0xC4, 0x01, 0x19, 0x2A, 0xD3, 0x93, 0x18, 0x3B, 0xBA, 0xA7, 0x80, 0x49, 0x09, 0x80, 0xC1, 0x48, 0x39, 0x98, 0xD2, 0x2A, 0x0C, 0xB0, 0x81, 0x73, 0x2A, 0x83, 0x82, 0x32, 0x9D, 0xF1, 0xB9, 0xC1, 0x38, 0x2F, 0x80, 0x93, 0x14, 0x38, 0x2A, 0xE8, 0xA1, 0x89, 0x2B, 0x99, 0x92, 0x86, 0x69, 0x99, 0x02, 0xC8, 0x13, 0x2F, 0x90, 0x00, 0x09, 0x08, 0x20, 0xD8, 0x03, 0x0C, 0x93, 0xA9, 0x14, 0x9C, 0x30, 0xAA, 0x87, 0x09, 0x28, 0x91, 0x59, 0xF0, 0x20, 0x9A, 0x20, 0x8A, 0x6A, 0x99, 0x83, 0xA2, 0x84, 0x29, 0x0B, 0xA0, 0x2E, 0x9A, 0xC4, 0x31, 0xD8, 0x84, 0x4A, 0x0A, 0xA1, 0x10, 0xA8, 0xA4, 0xB3, 0x12, 0x2A, 0x19, 0x82, 0x4F, 0x8A, 0x2B, 0xA9, 0x00, 0xB0, 0x48, 0xF6, 0x83, 0x08, 0x38, 0x09, 0x3A, 0xD0, 0x12, 0x8D, 0xC2, 0x02, 0x6C, 0xA0, 0x01, 0x9A, 0x00, 0x28, 0x2E, 0xC0, 0x42, 0xAA, 0xA7, 0x00, 0x90, 0x10, 0x8A, 0x22, 0x2D, 0x29, 0x1E, 0x81, 0x09, 0xA0, 0x80, 0x04, 0x1C, 0xF4, 0x01, 0xA1, 0x02, 0xB9, 0x96, 0x99, 0x84, 0x3D, 0x80, 0x3B, 0xA3, 0x5F, 0x98, 0x2A, 0xA0, 0x81, 0xD3, 0x91, 0x13, 0x2C, 0x92, 0x2B, 0x49, 0x0F, 0xA2, 0xA8, 0x86, 0x2A, 0x00, 0x1B, 0x83, 0x3D, 0x98, 0xB0, 0xB4, 0xD4, 0x31, 0x1B, 0x38, 0x9B, 0x04, 0x2D, 0x88, 0xB8, 0x03, 0x8A, 0x42, 0x9B, 0x97, 0xB2, 0xB4, 0x91, 0x39, 0xE9, 0x30, 0x8B, 0x62, 0xAA, 0x31, 0x2C, 0x00, 0xF4, 0x10, 0x0A, 0x19, 0xC4, 0x20, 0xD0, 0x83, 0xC1, 0x83, 0x89, 0x4C, 0x6B, 0x1C, 0xA1, 0x81, 0x82, 0x19, 0x80, 0x99, 0x7A, 0xC8, 0x32, 0x1E, 0x29, 0x09, 0x91, 0xC5, 0xA1, 0xB5, 0xA1, 0xB5, 0x39, 0x80, 0x5B, 0x89, 0x20, 0x4D, 0x0A, 0x49, 0x1C, 0x90, 0xC3, 0x82, 0xA0, 0xA2, 0x94, 0x09, 0xA2, 0x2C, 0x92, 0x09, 0xB7, 0x28, 0x18, 0x6C, 0x2B, 0x1A, 0x89, 0x01, 0x99, 0xC7, 0xC3, 0x12, 0x8A, 0x02, 0x3E, 0xC1, 0x11, 0x5C, 0x1B, 0xA1, 0x80, 0xB1, 0x93, 0x38, 0x3C, 0x2A, 0xC2, 0x79, 0x9A, 0x81, 0xF4, 0x82, 0x08, 0x6B, 0x99, 0x92, 0xB2, 0x02, 0x98, 0x90, 0x80, 0x4A, 0x18, 0x09, 0x4A, 0x18, 0x7F, 0x1B, 0x29, 0x1B, 0x90, 0xB3, 0x31, 0x1D, 0x90, 0xB4, 0xC3, 0xD4, 0xB3, 0xA3, 0x00, 0xA8, 0x93, 0xA1, 0xB7, 0x12, 0x4E, 0x3B, 0x3D, 0x09, 0x39, 0x3C, 0x0B, 0xC3, 0x48, 0x99, 0x82, 0xD0, 0xB4, 0xA3, 0xC4, 0xA2, 0xB2, 0x93, 0x00, 0x39, 0x09, 0x5F, 0x3C, 0x2A, 0x29, 0x2B, 0x0B, 0x09, 0xB3, 0xB7, 0xB5, 0x91, 0xB2, 0x82, 0xD2, 0x31, 0x2F, 0x29, 0x1A, 0x88, 0xC1, 0xB4, 0x92, 0x20, 0x3B, 0x4B, 0xA9, 0x10, 0xB0, 0x51, 0xD1, 0x6A, 0xA9, 0x11, 0x80, 0x01, 0x89, 0x1E, 0x80, 0x3A, 0xB4, 0x49, 0xC1, 0x00, 0xD5, 0x02, 0x09, 0x0A, 0x28, 0x0D, 0xA4, 0x18, 0x82, 0x4D, 0x90, 0x29, 0x8A, 0xD1, 0x94, 0x4A, 0x19, 0x3B, 0xB1, 0x22, 0x0C, 0xC3, 0xC1, 0xB3, 0x91, 0xA3, 0x68, 0x1A, 0x80, 0x5C, 0x0A, 0x38, 0x99, 0x20, 0xEC, 0x04, 0x98, 0x10, 0xD8, 0x03, 0xA0, 0x60, 0x0B, 0x01, 0xAA, 0x21, 0xCA, 0x85, 0x3A, 0x0A, 0xA4, 0x82, 0x48, 0x1E, 0x90, 0x09, 0x91, 0x3B, 0x88, 0x3D, 0x86, 0x19, 0xE4, 0x01, 0xD0, 0x82, 0x2A, 0xA2, 0x39, 0x0E, 0x69, 0xA0, 0x03, 0xBB, 0x22, 0x1B, 0x30, 0xE9, 0xA2, 0x81, 0x79, 0xB0, 0x01, 0x8B, 0x58, 0xA2, 0x49, 0xD8, 0x19, 0x80, 0x41, 0xF1, 0x00, 0x08, 0x38, 0xA0, 0xA1, 0x4B, 0x0E, 0x93, 0x30, 0xAB, 0xC3, 0x81, 0x86, 0x80, 0x80, 0x9D, 0x93, 0x59, 0x2A, 0xD8, 0x28, 0x92, 0x33, 0xD0, 0x1F, 0xB2, 0x30, 0xA2, 0x9B, 0xB3, 0x4F, 0x00, 0x90, 0xA3, 0xB0, 0x41, 0x0C, 0x81, 0x1B, 0x99, 0x87, 0x08, 0xE3, 0x10, 0x19, 0x48, 0x8B, 0xB0, 0x2C, 0xA4, 0x84, 0x19, 0x1B, 0x82, 0x12, 0xF0, 0x09, 0x0B, 0x31, 0xE4, 0x21, 0xB9, 0x13, 0x08, 0x2C, 0xC0, 0x00, 0x90, 0x39, 0x01, 0x1F, 0x94, 0x20, 0xB1, 0xAD, 0x93, 0x5B, 0x86, 0x8C, 0x08, 0x08, 0x07, 0xA9, 0x10, 0xB8, 0x23, 0xF3, 0x28, 0x99, 0x3C, 0x11, 0x1A, 0xA2, 0x0F, 0x82, 0x19, 0x04, 0x8A, 0x0A, 0xC1, 0x32, 0xC8, 0x08, 0xC1, 0x96, 0x01, 0x3B, 0xA9, 0x68, 0x2C, 0x39, 0xB9, 0xB1, 0x11, 0x11, 0x04, 0xB1, 0x98, 0x0C, 0x09, 0x58, 0x8E, 0x00, 0x91, 0x87, 0xA1, 0xB3, 0xB8, 0x04, 0x89, 0x18, 0x2F, 0x5A, 0x0A, 0x81, 0x08, 0xA8, 0xB4, 0x01, 0xD7, 0x11, 0x09, 0x5B, 0x2B, 0x08, 0xA0, 0x38, 0xD8, 0xA6, 0xB1, 0x83, 0x89, 0x93, 0x18, 0x59, 0x3F, 0x1B, 0xA1, 0x93, 0x98, 0xB1, 0xA1, 0x97, 0x19, 0x08, 0x91, 0x87, 0x2C, 0x39, 0x0D, 0x01, 0x8B, 0x94, 0xA0, 0x81, 0x91, 0x71, 0x3B, 0x89, 0xC8, 0x93, 0xC2, 0xB3, 0xE3, 0x82, 0x09, 0x48, 0xA0, 0x12, 0x1C, 0x78, 0x8B, 0x5A, 0x9A, 0x10, 0x91, 0x80, 0xA1, 0xB5, 0x50, 0x0B, 0xC5, 0x80, 0x18, 0x0A, 0xA3, 0x91, 0x05, 0x9A, 0xC1, 0xB6, 0x08, 0x4B, 0x3A, 0x6A, 0x19, 0x10, 0x2B, 0x9A, 0xF0, 0x80, 0x10, 0x39, 0xF9, 0x85, 0x00, 0x10, 0x99, 0x93, 0xCB, 0x08, 0x89, 0x13, 0x90, 0x7F, 0x18, 0xB1, 0xA3, 0x1E, 0x81, 0x19, 0x08, 0x1D, 0xA3, 0x01, 0x94, 0x29, 0x89, 0x9C, 0xA0, 0xB3, 0x96, 0xB1, 0x12, 0x78, 0x3B, 0x0A, 0x3B, 0xA7, 0x08, 0x0C, 0x1A, 0x58, 0x2B, 0xA1, 0x00, 0x28, 0x91, 0xC7, 0xB1, 0x10, 0x28, 0xA8, 0xC8, 0x41, 0x4C, 0x81, 0x80, 0x3B, 0xFA, 0x82, 0xC4, 0x01, 0x0A, 0x38, 0x39, 0x29, 0x0F, 0x92, 0x69, 0x9A, 0x29, 0x00, 0x1A, 0xD3, 0xA2, 0xB3, 0x80, 0x4B, 0xD3, 0x87};
+
+#endif /* AUDIOARRAYS_H_ */
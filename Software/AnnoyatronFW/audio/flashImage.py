@@ -0,0 +1,242 @@
+"""External flash image tool for the annoyatron AUDIO_SPI_FLASH build
+
+"build" runs the clips in parseWaveFile.py's CLIPS list through the same pipeline as audioArrays.h, but writes
+them into a binary image for the SPI NOR flash instead, with no 16kB limit on their length. Flash the image onto
+the part with any SPI programmer.
+
+"play" reads an image back exactly the way Audio.c and spiflash.c do: the header, then each clip's directory entry,
+then its bytes from the entry's offset, decoded with the firmware's ADPCM decoder. Each playable clip is written out
+as an 8 bit .WAV at its own sample rate. The image file stands in for the flash chip, so a new image can be checked
+on the host before it is flashed, and any clip the firmware would refuse to play is reported.
+"""
+import argparse  # Standard Python Library to parse command line arguments
+import os  # Standard Python Library to locate files relative to this script
+import re  # Standard Python Library to read settings out of the firmware sources
+import struct  # Standard Python Library to pack and unpack the image layout
+import sys  # Standard Python Library to set the exit status
+import wave  # Standard Python Library to deal with .WAV files
+
+import parseWaveFile
+
+# Image layout, these must match spiflash.h in the firmware exactly
+IMAGE_MAGIC = 0x31594E41  # SPIFLASH_IMAGE_MAGIC, "ANY1"
+HEADER_FORMAT = "<IB3x"  # spiflash_header_t: magic, clipCount, reserved
+ENTRY_FORMAT = "<IIIHBx"  # spiflash_clip_t: offset, numSamples, loopStart, sampleRate, format, reserved
+EMPTY_FORMAT = 0xFF  # format of a directory slot with no clip in it, the firmware refuses to play it
+FORMAT_CODES = {"pcm8": 0, "adpcm4": 1}  # AUDIO_FORMAT_PCM8 and AUDIO_FORMAT_ADPCM4 in audioArrays.h
+
+
+def firmwareClipIds(audioHeaderFile):
+    """Read the audio_clip_t enum from Audio.h, which the flash directory is indexed by
+
+    Args:
+        audioHeaderFile (string): path to the firmware's Audio.h
+
+    Returns:
+        dict: clip enum name to its value, including audio_clip_count
+    """
+    with open(audioHeaderFile, "r") as f:
+        text = f.read()
+
+    match = re.search(r"typedef enum audio_clip_enum\s*\{([^}]*)\}", text)
+    if match is None:
+        raise ValueError("could not find audio_clip_t in " + audioHeaderFile)
+    names = re.findall(r"^\s*(audio_clip_\w+)", match.group(1), re.MULTILINE)
+    return {name: value for value, name in enumerate(names)}
+
+
+def firmwareMinSampleRate(carrierHz):
+    """Return the slowest sample rate the TCA0 underflow interrupt can pace, AUDIO_MIN_SAMPLE_RATE_HZ in Audio.c
+
+    Args:
+        carrierHz (int): the firmware's AUDIO_CARRIER_HZ
+
+    Returns:
+        int: AUDIO_MIN_SAMPLE_RATE_HZ
+    """
+    return carrierHz // 65536 + 1
+
+
+def firmwareCarrierFrequency(mainHeaderFile):
+    """Work out AUDIO_CARRIER_HZ from F_CPU, AUDIO_PWM_PRESCALER and AUDIO_PWM_PERIOD in main.h
+
+    Args:
+        mainHeaderFile (string): path to the firmware's main.h
+
+    Returns:
+        int: AUDIO_CARRIER_HZ in Hz
+    """
+    with open(mainHeaderFile, "r") as f:
+        text = f.read()
+
+    values = {}
+    for name in ("F_CPU", "AUDIO_PWM_PRESCALER", "AUDIO_PWM_PERIOD"):
+        match = re.search(r"#define\s+" + name + r"\s+(\d+)", text)
+        if match is None:
+            raise ValueError("could not find " + name + " in " + mainHeaderFile)
+        values[name] = int(match.group(1))
+    return values["F_CPU"] // (values["AUDIO_PWM_PRESCALER"] * values["AUDIO_PWM_PERIOD"])
+
+
+def writeImage(clips, clipIds, outFileName, flashSize):
+    """Lay the clips out in a flash image: header, directory indexed by audio_clip_t, then the clip bytes
+
+    Args:
+        clips (list): encoded clips from parseWaveFile.buildClip(), each with its "id"
+        clipIds (dict): audio_clip_t values from firmwareClipIds()
+        outFileName (string): filename and optionally path of the image to write
+        flashSize (int): size of the flash part in bytes
+
+    Returns:
+        boolean: True if the image was written, False if it does not fit in the part
+    """
+    clipCount = clipIds["audio_clip_count"]
+    entries = [struct.pack(ENTRY_FORMAT, 0, 0, 0, 0, EMPTY_FORMAT)] * clipCount
+    offset = struct.calcsize(HEADER_FORMAT) + clipCount * struct.calcsize(ENTRY_FORMAT)
+    body = bytearray()
+
+    for clip in clips:
+        entries[clipIds[clip["id"]]] = struct.pack(ENTRY_FORMAT, offset + len(body), clip["numSamples"],
+                                                   clip.get("loopStart", 0), clip["rate"], FORMAT_CODES[clip["format"]])
+        body += clip["data"]
+
+    image = struct.pack(HEADER_FORMAT, IMAGE_MAGIC, clipCount) + b"".join(entries) + body
+    print('\nimage uses', len(image), 'of', flashSize, 'bytes of flash')
+    if len(image) > flashSize:
+        return False
+
+    with open(outFileName, "wb") as f:
+        f.write(image)
+    print('wrote image to:', outFileName)
+    return True
+
+
+def playImage(inFileName, clipIds, minRate, maxRate, loops):
+    """Decode every clip in an image as the firmware would and write each to <clip>.sim.wav
+
+    Args:
+        inFileName (string): the image, standing in for the flash part
+        clipIds (dict): audio_clip_t values from firmwareClipIds()
+        minRate (int): AUDIO_MIN_SAMPLE_RATE_HZ
+        maxRate (int): AUDIO_MAX_SAMPLE_RATE_HZ
+        loops (int): times to play each clip, going back to its loop point in between like audio_mode_loop
+
+    Returns:
+        boolean: True if the image is valid and every clip in it is playable, else False
+    """
+    with open(inFileName, "rb") as f:
+        image = f.read()
+
+    headerSize = struct.calcsize(HEADER_FORMAT)
+    entrySize = struct.calcsize(ENTRY_FORMAT)
+    magic, clipCount = struct.unpack_from(HEADER_FORMAT, image, 0)
+    if magic != IMAGE_MAGIC:
+        print("ERROR: no image header, the firmware plays nothing from this flash")
+        return False
+
+    isValid = True
+    names = {value: name for name, value in clipIds.items()}
+    for clipId in range(clipCount):
+        offset, numSamples, loopStart, rate, fmt = struct.unpack_from(ENTRY_FORMAT, image, headerSize + clipId * entrySize)
+        name = names.get(clipId, "clip " + str(clipId))
+        if fmt == EMPTY_FORMAT:
+            continue
+        # the same checks openFlashClip() makes in Audio.c
+        if fmt not in FORMAT_CODES.values() or not numSamples or loopStart >= numSamples or not minRate <= rate <= maxRate:
+            print("ERROR:", name, "has an invalid directory entry, the firmware will not play it")
+            isValid = False
+            continue
+        length = (numSamples + 1) // 2 if fmt == FORMAT_CODES["adpcm4"] else numSamples
+        if offset + length > len(image):
+            print("ERROR:", name, "runs past the end of the image")
+            isValid = False
+            continue
+
+        samples = decodeClip(image, offset, numSamples, loopStart, fmt, loops)
+        outFileName = name + ".sim.wav"
+        with wave.open(outFileName, "wb") as w:
+            w.setnchannels(1)
+            w.setsampwidth(1)
+            w.setframerate(rate)
+            w.writeframes(samples)
+        print('\t{:<16} {:>8} Hz {:>8} samples, loop from {:>8} -> {}'.format(name, rate, numSamples, loopStart, outFileName))
+
+    return isValid
+
+
+def decodeClip(image, offset, numSamples, loopStart, fmt, loops):
+    """Produce the samples nextSample() in Audio.c feeds the PWM, including going back to the loop point
+
+    Args:
+        image (bytes): the whole image
+        offset (int): image address of the clip's first byte
+        numSamples (int): samples in the clip
+        loopStart (int): sample the clip goes back to after each pass
+        fmt (int): AUDIO_FORMAT_PCM8 or AUDIO_FORMAT_ADPCM4
+        loops (int): number of passes
+
+    Returns:
+        bytes: unsigned 8 bit samples
+    """
+    out = bytearray()
+    predictor, stepIndex = 0, 0
+    loopState = (predictor, stepIndex)
+    idx = 0
+    for _ in range(loops):
+        while idx < numSamples:
+            if idx == loopStart:
+                loopState = (predictor, stepIndex)
+            if fmt == FORMAT_CODES["adpcm4"]:
+                code = (image[offset + (idx >> 1)] >> (4 * (idx & 1))) & 0x0F
+                predictor, stepIndex = parseWaveFile.adpcmStep(predictor, stepIndex, code)
+                out.append(((predictor & 0xFFFF) >> 8) ^ 0x80)
+            else:
+                out.append(image[offset + idx])
+            idx += 1
+        idx = loopStart
+        predictor, stepIndex = loopState
+    return bytes(out)
+
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+AUDIO_HEADER_FILE = os.path.join(SCRIPT_DIR, "..", "Audio.h")
+MAIN_HEADER_FILE = os.path.join(SCRIPT_DIR, "..", "main.h")
+OUTPUT_FILE = os.path.join(SCRIPT_DIR, "flashImage.bin")
+FLASH_SIZE = 4 * 1024 * 1024  # a 32Mbit part, pass --size for anything else
+
+
+# Now just run the script with reasonable defaults if this script
+#   is invoked directly
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Build or check the external flash image for the AUDIO_SPI_FLASH firmware")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+    buildParser = subparsers.add_parser("build", help="encode the clips into a flash image")
+    buildParser.add_argument("--format", choices=["adpcm4", "pcm8"], help="override the format of every clip")
+    buildParser.add_argument("--rate", type=int, help="override the sample rate of every clip in Hz")
+    buildParser.add_argument("--size", type=int, default=FLASH_SIZE, help="size of the flash part in bytes")
+    buildParser.add_argument("--output", default=OUTPUT_FILE, help="image to generate")
+    playParser = subparsers.add_parser("play", help="decode an image the way the firmware does, into .WAV files")
+    playParser.add_argument("--loops", type=int, default=1, help="passes through each clip, to hear its loop point")
+    playParser.add_argument("image", nargs="?", default=OUTPUT_FILE, help="image to read")
+    args = parser.parse_args()
+
+    print("Starting...")
+    clipIds = firmwareClipIds(AUDIO_HEADER_FILE)
+    maxRate = parseWaveFile.firmwareMaxSampleRate(AUDIO_HEADER_FILE)
+    minRate = firmwareMinSampleRate(firmwareCarrierFrequency(MAIN_HEADER_FILE))
+
+    if args.command == "build":
+        os.chdir(SCRIPT_DIR)
+        clipList = [dict(clip, format=args.format or clip["format"], rate=args.rate or clip["rate"]) for clip in parseWaveFile.CLIPS]
+        for clip in clipList:
+            if not minRate <= clip["rate"] <= maxRate:
+                print("ERROR:", clip["name"], "is set to", clip["rate"], "Hz, the firmware plays", minRate, "to", maxRate, "Hz")
+                sys.exit(1)
+        encoded = [parseWaveFile.buildClip(clip, parseWaveFile.OUTPUT_FILE) for clip in clipList]
+        if not writeImage(encoded, clipIds, args.output, args.size):
+            print("ERROR: clips do not fit in the flash part. " + args.output + " was not changed")
+            sys.exit(1)
+    elif not playImage(args.image, clipIds, minRate, maxRate, args.loops):
+        sys.exit(1)
+
+    print("Done!")
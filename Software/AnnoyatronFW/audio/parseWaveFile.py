@@ -1,66 +1,448 @@
+"""Asset pipeline for the annoyatron audio clips
+
+Reads each clip's .WAV file, resamples it to the clip's sample rate, dithers it down to
+8 bits, optionally ADPCM-encodes it, and writes audioArrays.h directly. A flash report is printed for every
+run, and nothing is written if the clips plus the firmware code would not fit in the ATtiny1606.
+"""
+import argparse  # Standard Python Library to parse command line arguments
+import math  # Standard Python Library for the resampling filter
+import os  # Standard Python Library to locate files relative to this script
+import random  # Standard Python Library to generate dither noise
+import re  # Standard Python Library to read settings out of the firmware sources
+import subprocess  # Standard Python Library to measure the code size of a built firmware
+import sys  # Standard Python Library to set the exit status
 import wave  # Standard Python Library to deal with .WAV files
 
+# IMA-ADPCM tables, these must match adpcm.c in the firmware exactly
+ADPCM_STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767]
+ADPCM_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
+
 
-def parseWavFile(inFileName, outFileName, isWinNotLose):
-    """Read an input wave file, write out a C-style header variable to feed into annoyatron Firmware
+def adpcmStep(predictor, stepIndex, code):
+    """Apply one 4 bit ADPCM code to a decoder state, exactly as adpcm_decode() does in the firmware
 
     Args:
-        inFileName (string): filename and optionally path to an 8 bit wave file to convert
-        outFileName (string): filename and optionally path where resulting C header should be written
-        isWinNotLose (boolean): True = name resulting array in the header "youWin", else it's named "youLose"
- 
+        predictor (int): current signed 16 bit predictor
+        stepIndex (int): current index into ADPCM_STEP_TABLE
+        code (int): the 4 bit ADPCM code, bit 3 is the sign
+
     Returns:
-        None
+        tuple: the next (predictor, stepIndex)
+    """
+    step = ADPCM_STEP_TABLE[stepIndex]
+    diff = step >> 3
+    if code & 4:
+        diff += step
+    if code & 2:
+        diff += step >> 1
+    if code & 1:
+        diff += step >> 2
+
+    predictor = predictor - diff if code & 8 else predictor + diff
+    predictor = max(-32768, min(32767, predictor))
+    stepIndex = max(0, min(len(ADPCM_STEP_TABLE) - 1, stepIndex + ADPCM_INDEX_TABLE[code & 7]))
+    return predictor, stepIndex
+
+
+def adpcmSearch(predictor, stepIndex, targets, depth):
+    """Return the lowest squared error reachable over the next 'depth' target samples
+
+    Args:
+        predictor (int): decoder predictor before the first target
+        stepIndex (int): decoder step index before the first target
+        targets (list): upcoming signed 16 bit target samples
+        depth (int): how many of the targets to search over
+
+    Returns:
+        tuple: (squared error, first code) of the best path
+    """
+    best = (None, 0)
+    if depth == 0 or not targets:
+        return 0, 0
+
+    for code in range(16):
+        nextPredictor, nextStepIndex = adpcmStep(predictor, stepIndex, code)
+        error = (nextPredictor - targets[0]) ** 2
+        if best[0] is not None and error >= best[0]:
+            continue
+        error += adpcmSearch(nextPredictor, nextStepIndex, targets[1:], depth - 1)[0]
+        if best[0] is None or error < best[0]:
+            best = (error, code)
+    return best
+
+
+def encodeAdpcm(data, lookahead=3):
+    """Encode unsigned 8 bit PCM bytes into 4 bit IMA-ADPCM, two samples per byte with the low nibble first
+
+    Rather than the textbook greedy quantizer, each code is picked by searching 'lookahead' samples ahead
+    through the firmware's own decoder. This costs nothing on the device but noticeably cleans up the sharp
+    consonants, which the greedy encoder smears. Encoding starts from the same zeroed decoder state
+    that adpcm_reset() gives the firmware.
+
+    Args:
+        data (bytes): unsigned 8 bit PCM samples, 0x80 is silence
+        lookahead (int): number of samples to search over when choosing each code, 1 is plain IMA encoding
+
+    Returns:
+        bytes: the packed ADPCM stream, half the length of the input (rounded up)
+    """
+    # the decoder keeps the high byte of the predictor, so aim for the middle of each 8 bit step
+    targets = [((sample - 0x80) << 8) + 0x80 for sample in data]
+    predictor = 0
+    stepIndex = 0
+    nibbles = []
+
+    for idx in range(len(targets)):
+        code = adpcmSearch(predictor, stepIndex, targets[idx:idx + lookahead], lookahead)[1]
+        predictor, stepIndex = adpcmStep(predictor, stepIndex, code)
+        nibbles.append(code)
+
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes(nibbles[idx] | (nibbles[idx + 1] << 4) for idx in range(0, len(nibbles), 2))
+
+
+def firmwareMaxSampleRate(audioHeaderFile):
+    """Read the fastest sample rate the firmware can play a clip at from Audio.h
+
+    Args:
+        audioHeaderFile (string): path to the firmware's Audio.h
+
+    Returns:
+        int: AUDIO_MAX_SAMPLE_RATE_HZ
     """
-    print('\nparsing ', inFileName)
+    with open(audioHeaderFile, "r") as f:
+        text = f.read()
+
+    match = re.search(r"#define\s+AUDIO_MAX_SAMPLE_RATE_HZ\s+(\d+)", text)
+    if match is None:
+        raise ValueError("could not find AUDIO_MAX_SAMPLE_RATE_HZ in " + audioHeaderFile)
+    return int(match.group(1))
+
+
+def readWavFile(inFileName):
+    """Read a PCM .WAV file of any common sample width, mixing it down to mono floats
+
+    Args:
+        inFileName (string): filename and optionally path to the wave file
 
+    Returns:
+        tuple: (list of float samples in -1.0 to 1.0, sample rate in Hz, sample width in bytes)
+    """
     with wave.open(inFileName, "r") as w:
         framerate = w.getframerate()
         frames = w.getnframes()
         channels = w.getnchannels()
         width = w.getsampwidth()
-        print('\tsampling rate:', framerate, 'Hz')
-        print('\tlength:', frames, 'samples')
-        print('\tchannels:', channels)
-        print('\tsample width:', width, 'bytes')
-
+        if w.getcomptype() != "NONE":
+            raise ValueError(inFileName + " is compressed (" + w.getcompname() + "), export it as plain PCM")
         data = w.readframes(frames)
 
-    with open("Outputs/"+outFileName, "w") as f:
-        structname = "youWin" if isWinNotLose else "youLose";
-        comment  = "/**\n"
-        comment += " * AUTOGENERATED by Chase E Stewart for the AVR-Annoyatron\n"
-        comment += " * copy the line below containing giant struct \"" + structname + "\" into audioArray.h,\n"
-        comment += " * clobbering the existing struct already in audioArray.h\n"
-        comment += " */\n"
-        f.write(comment)
-        struct_start = "const uint8_t " + structname + "[] = {"
-        f.write(struct_start)
+    print('\tsampling rate:', framerate, 'Hz')
+    print('\tlength:', frames, 'samples')
+    print('\tchannels:', channels)
+    print('\tsample width:', width, 'bytes')
+    if width not in (1, 2, 3, 4):
+        raise ValueError(inFileName + " has an unsupported sample width of " + str(width) + " bytes")
+
+    samples = []
+    fullScale = float(1 << (8 * width - 1))
+    for frame in range(frames):
+        total = 0.0
+        for channel in range(channels):
+            offset = (frame * channels + channel) * width
+            raw = data[offset:offset + width]
+            if width == 1:
+                value = raw[0] - 0x80  # 8 bit .WAV is unsigned, everything wider is signed
+            else:
+                value = int.from_bytes(raw, "little", signed=True)
+            total += value / fullScale
+        samples.append(total / channels)
+
+    return samples, framerate, width
+
+
+def resample(samples, inRate, outRate, taps=32):
+    """Resample with a Hann-windowed sinc interpolator, low-passing below the lower of the two Nyquist rates
+
+    Args:
+        samples (list): float samples at inRate
+        inRate (float): input sample rate in Hz
+        outRate (float): output sample rate in Hz
+        taps (int): filter half-width in input samples, more is sharper and slower
+
+    Returns:
+        list: float samples at outRate
+    """
+    ratio = inRate / outRate
+    cutoff = min(1.0, outRate / inRate) * 0.95  # leave a little room for the filter's transition band
+    reach = int(math.ceil(taps / cutoff)) if cutoff < 1.0 else taps
+    outLen = int(len(samples) / ratio)
+    out = []
+
+    for n in range(outLen):
+        center = n * ratio
+        first = int(math.floor(center)) - reach + 1
+        total = 0.0
+        for k in range(first, first + 2 * reach):
+            if k < 0 or k >= len(samples):
+                continue
+            t = center - k
+            window = 0.5 + 0.5 * math.cos(math.pi * t / reach)
+            x = math.pi * t * cutoff
+            sinc = 1.0 if x == 0 else math.sin(x) / x
+            total += samples[k] * sinc * window * cutoff
+        out.append(total)
+
+    return out
+
+
+def ditherTo8Bit(samples, isDithered=True):
+    """Quantize float samples to unsigned 8 bit PCM with triangular (TPDF) dither
+
+    Args:
+        samples (list): float samples in -1.0 to 1.0
+        isDithered (boolean): False to round without dither, e.g. if the source was already 8 bit
+
+    Returns:
+        bytes: unsigned 8 bit samples, 0x80 is silence
+    """
+    out = bytearray()
+    clipped = 0
+    for sample in samples:
+        value = sample * 128.0 + 128.0
+        if isDithered:
+            value += random.random() - random.random()
+        quantized = int(math.floor(value + 0.5))
+        if quantized < 0 or quantized > 255:
+            clipped += 1
+            quantized = max(0, min(255, quantized))
+        out.append(quantized)
+
+    if clipped:
+        print('\tWARNING:', clipped, 'samples clipped, lower the level of the source file')
+    return bytes(out)
+
+
+def readExistingClip(headerFileName, name):
+    """Pull an already-encoded clip back out of a previously generated audioArrays.h
+
+    Used when a clip's .WAV file is not at hand (the .WAV files are not checked in), so the clips that are
+    not being changed can be carried over unmodified.
+
+    Args:
+        headerFileName (string): path to the existing audioArrays.h
+        name (string): array name of the clip
+
+    Returns:
+        tuple: (encoded bytes, format string, number of samples, sample rate in Hz)
+    """
+    with open(headerFileName, "r") as f:
+        text = f.read()
+
+    match = re.search(r"const uint8_t " + name + r"\[\] = \{([^}]*)\}", text)
+    if match is None:
+        raise ValueError("no clip named " + name + " in " + headerFileName)
+    data = bytes(int(value, 16) for value in match.group(1).split(","))
+
+    macro = name.upper()
+    formatMatch = re.search(r"#define " + macro + r"_FORMAT AUDIO_FORMAT_(\w+)", text)
+    lengthMatch = re.search(r"#define " + macro + r"_NUM_SAMPLES (\d+)", text)
+    rateMatch = re.search(r"#define " + macro + r"_SAMPLE_RATE_HZ (\d+)", text)
+    if formatMatch is None or lengthMatch is None or rateMatch is None:
+        raise ValueError(headerFileName + " predates the asset pipeline, regenerate " + name + " from its .WAV file")
+
+    return data, formatMatch.group(1).lower(), int(lengthMatch.group(1)), int(rateMatch.group(1))
+
+
+def buildClip(clip, existingHeader):
+    """Run one clip through the pipeline: read, resample, dither and encode
+
+    Args:
+        clip (dict): one entry of CLIPS
+        existingHeader (string): audioArrays.h to carry the clip over from if its .WAV is missing
+
+    Returns:
+        dict: the clip with its encoded 'data' and 'numSamples' filled in
+    """
+    result = dict(clip)
+    print('\nparsing', clip["name"], 'from', clip["input"])
+
+    if not os.path.exists(clip["input"]):
+        data, fmt, numSamples, rate = readExistingClip(existingHeader, clip["name"])
+        print('\t', clip["input"], 'not found, keeping the', fmt, 'clip already in', os.path.basename(existingHeader))
+        if fmt != clip["format"] or rate != clip["rate"]:
+            print('\tWARNING: asked for', clip["format"], 'at', clip["rate"], 'Hz but the kept clip is', fmt, 'at', rate,
+                  'Hz, add', clip["input"], 'to re-encode it')
+        result.update(data=data, format=fmt, numSamples=numSamples, rate=rate)
+        return result
+
+    samples, inRate, width = readWavFile(clip["input"])
+    isResampled = inRate != clip["rate"]
+    if isResampled:
+        print('\tresampling', inRate, 'Hz ->', clip["rate"], 'Hz')
+        samples = resample(samples, inRate, clip["rate"])
+    pcm = ditherTo8Bit(samples, isDithered=(width > 1 or isResampled))
+
+    if clip["format"] == "adpcm4":
+        data = encodeAdpcm(pcm)
+    elif clip["format"] == "pcm8":
+        data = pcm
+    else:
+        raise ValueError("unknown format " + clip["format"] + " for " + clip["name"])
+
+    result.update(data=data, numSamples=len(pcm))
+    return result
+
+
+def writeAudioHeader(clips, outFileName):
+    """Write every clip into audioArrays.h along with the macros the firmware uses to play it
 
-        outputarray = []
-        for idx in range(len(data)):
-            outputarray.append("0x{:02X}".format(data[idx]))
+    Args:
+        clips (list): encoded clips from buildClip()
+        outFileName (string): filename and optionally path of the header to write
+
+    Returns:
+        None
+    """
+    with open(outFileName, "w") as f:
+        f.write("/*!\n")
+        f.write(" * @file audioArrays.h\n")
+        f.write(" *\n")
+        f.write(" * AUTOGENERATED by parseWaveFile.py for the AVR-Annoyatron, do not edit by hand\n")
+        f.write(" *\n")
+        f.write(" * Contains short audio samples, each at its own sample rate, either as raw 8 bit arrays or as\n")
+        f.write(" * 4 bit IMA-ADPCM arrays with two samples per byte and the low nibble first. See adpcm.h for the decoder\n")
+        f.write(" * \n")
+        f.write(" * These are checked against the flash of the attiny1606 by the script that generates them\n")
+        f.write(" */ \n\n")
+        f.write("#include \"stdint.h\"\n\n")
+        f.write("#ifndef AUDIOARRAYS_H_\n")
+        f.write("#define AUDIOARRAYS_H_\n\n")
+        f.write("#define AUDIO_FORMAT_PCM8 0  ///< Clip is stored as unsigned 8 bit samples\n")
+        f.write("#define AUDIO_FORMAT_ADPCM4 1  ///< Clip is stored as 4 bit IMA-ADPCM codes\n\n")
+
+        for clip in clips:
+            macro = clip["name"].upper()
+            f.write("#define " + macro + "_FORMAT AUDIO_FORMAT_" + clip["format"].upper() + "  ///< Storage format of " + clip["name"] + "\n")
+            f.write("#define " + macro + "_NUM_SAMPLES " + str(clip["numSamples"]) + "  ///< Number of samples in " + clip["name"] + "\n")
+            f.write("#define " + macro + "_SAMPLE_RATE_HZ " + str(clip["rate"]) + "  ///< Sample rate of " + clip["name"] + " in HZ\n")
+            f.write("#define " + macro + "_LOOP_START " + str(clip.get("loopStart", 0)) + "  ///< Sample of " + clip["name"] + " that audio_mode_loop goes back to\n")
+            f.write("/** @hideinitializer " + clip["description"] + " */\n")
+            f.write("const uint8_t " + clip["name"] + "[] = {")
+            f.write(", ".join("0x{:02X}".format(value) for value in clip["data"]))
+            f.write("};\n\n")
+
+        f.write("#endif /* AUDIOARRAYS_H_ */\n")
 
-        f.write(", ".join(outputarray))
-        f.write("};")
+    print('\nwrote output to:', outFileName)
 
-    print('\twrote output to: ', outFileName)
 
+def codeSizeFromElf(elfFileName, clipNames):
+    """Measure the flash used by everything except the audio clips in a built firmware
 
-# Edit these to match your desired input- and output-filenames
-WIN_INPUT_FILE = "YouWin.wav"
-WIN_OUTPUT_FILE = "YouWinHeader.h"
-WIN_IS_WIN = True
+    Args:
+        elfFileName (string): the firmware .elf built by Microchip Studio or the avr-gcc Makefile
+        clipNames (list): array names of the clips, which are subtracted from the total
+
+    Returns:
+        int: bytes of flash used by code and other constant data
+    """
+    sizes = subprocess.run(["avr-size", "-A", elfFileName], capture_output=True, text=True, check=True).stdout
+    total = 0
+    for line in sizes.splitlines():
+        fields = line.split()
+        if len(fields) >= 2 and fields[0] in (".text", ".data", ".rodata"):
+            total += int(fields[1])
 
-LOSE_INPUT_FILE = "YouLose.wav"
-LOSE_OUTPUT_FILE = "YouLoseHeader.h"
-LOSE_IS_WIN = False
+    symbols = subprocess.run(["avr-nm", "-S", elfFileName], capture_output=True, text=True, check=True).stdout
+    for line in symbols.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[3] in clipNames:
+            total -= int(fields[1], 16)
+
+    return total
+
+
+def printFlashReport(clips, codeSize):
+    """Print how much flash each clip takes and check the total against the ATtiny1606
+
+    Args:
+        clips (list): encoded clips from buildClip()
+        codeSize (int): bytes of flash used by the firmware apart from the clips
+
+    Returns:
+        boolean: True if everything fits in flash, else False
+    """
+    print('\nflash report')
+    print('\t{:<10} {:>8} {:>8} {:>8} {:>8} {:>8}'.format('clip', 'format', 'rate', 'samples', 'seconds', 'bytes'))
+    assetTotal = 0
+    for clip in clips:
+        assetTotal += len(clip["data"])
+        print('\t{:<10} {:>8} {:>8} {:>8} {:>8.2f} {:>8}'.format(clip["name"], clip["format"], clip["rate"], clip["numSamples"],
+                                                                clip["numSamples"] / clip["rate"], len(clip["data"])))
+
+    total = assetTotal + codeSize
+    print('\t{:<10} {:>44}'.format('assets', assetTotal))
+    print('\t{:<10} {:>44}'.format('code', codeSize))
+    print('\t{:<10} {:>44} of {} ({} free)'.format('total', total, FLASH_SIZE, FLASH_SIZE - total))
+    return total <= FLASH_SIZE
+
+
+# Edit these to match your desired input files and clip formats
+# "adpcm4" takes half a byte per sample, "pcm8" takes a full byte but sounds cleaner
+# "rate" is the sample rate in Hz the clip is resampled to and played back at, up to AUDIO_MAX_SAMPLE_RATE_HZ
+# "loopStart" optionally sets the sample a looping clip goes back to, from the start by default
+# The countdown siren is not a clip, the firmware synthesizes it, see siren.c
+# "id" is the clip's audio_clip_t in Audio.h, which flashImage.py uses to place it in the external flash directory
+# A new clip also needs an audio_clip_t in Audio.h and an entry in clipTable in Audio.c
+CLIPS = [
+    {"name": "youWin", "id": "audio_clip_win", "input": "YouWin.wav", "format": "adpcm4", "rate": 8000,
+     "description": "The shutdown noise to play once after a success"},
+    {"name": "youLose", "id": "audio_clip_lose", "input": "YouLose.wav", "format": "adpcm4", "rate": 8000,
+     "description": "The goodbye noise to play once after a failure"},
+]
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+AUDIO_HEADER_FILE = os.path.join(SCRIPT_DIR, "..", "Audio.h")
+OUTPUT_FILE = os.path.join(SCRIPT_DIR, "audioArrays.h")
+FLASH_SIZE = 16384  # ATtiny1606 flash in bytes
+CODE_SIZE_ESTIMATE = 4096  # Flash used by the firmware without its clips, use --elf or --code-size to be exact
 
 
 # Now just run the script with reasonable defaults if this script
 #   is invoked directly 
 if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Generate audioArrays.h for the annoyatron firmware")
+    parser.add_argument("--format", choices=["adpcm4", "pcm8"], help="override the format of every clip")
+    parser.add_argument("--rate", type=int, help="override the sample rate of every clip in Hz")
+    parser.add_argument("--elf", help="measure the code size from a built firmware .elf (needs avr-size and avr-nm)")
+    parser.add_argument("--code-size", type=int, default=CODE_SIZE_ESTIMATE, help="flash used by the firmware apart from the clips")
+    parser.add_argument("--output", default=OUTPUT_FILE, help="header to generate")
+    args = parser.parse_args()
+
     print("Starting...")
-    parseWavFile(WIN_INPUT_FILE, WIN_OUTPUT_FILE, WIN_IS_WIN)
-    parseWavFile(LOSE_INPUT_FILE, LOSE_OUTPUT_FILE, LOSE_IS_WIN)
-    print("Done!")
\ No newline at end of file
+    os.chdir(SCRIPT_DIR)
+    maxRate = firmwareMaxSampleRate(AUDIO_HEADER_FILE)
+
+    clipList = [dict(clip, format=args.format or clip["format"], rate=args.rate or clip["rate"]) for clip in CLIPS]
+    for clip in clipList:
+        if clip["rate"] > maxRate:
+            print("ERROR:", clip["name"], "is set to", clip["rate"], "Hz, the firmware plays at most", maxRate, "Hz")
+            sys.exit(1)
+    encoded = [buildClip(clip, OUTPUT_FILE) for clip in clipList]
+    code = codeSizeFromElf(args.elf, [clip["name"] for clip in CLIPS]) if args.elf else args.code_size
+
+    if not printFlashReport(encoded, code):
+        print("ERROR: clips do not fit in flash, shorten them or use adpcm4. " + args.output + " was not changed")
+        sys.exit(1)
+
+    writeAudioHeader(encoded, args.output)
+    print("Done!")
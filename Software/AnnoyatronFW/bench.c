@@ -0,0 +1,145 @@
+/*!
+ * @file bench.c
+ *
+ * Cycle counting instrumentation for the BENCHMARK build
+ *
+ * TCB0 is left free-running over its whole 16 bit range on CLK_PER, and its CAPT interrupt counts
+ * the wraps every 6.5 msec into the high half of a 32 bit stamp. The difference of two stamps is the
+ * number of CPU cycles between them, so a region that blocks or sleeps past a wrap is seen as long
+ * rather than as a small wrong number. Such runs are saturated to 0xFFFF and counted in overflows.
+ * TCB0 is free once timebase_init() has finished calibrating the RTC with it.
+ * The boot takes longer than TCB0 can count, so it is timed on the RTC instead, which
+ * timebase_init() starts from zero.
+ *
+ */
+
+#ifdef BENCHMARK
+
+#include "bench.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+bench_stat_t benchStats[bench_id_count];  ///< Statistics per bench_id_t, read back over UPDI by benchmark.py
+uint16_t benchBootRtcCycles;  ///< RTC cycles from timebase_init() to bench_boot(), read back over UPDI by benchmark.py
+static volatile uint16_t benchWraps;  ///< TCB0 wraps since bench_init(), the high half of bench_now()
+
+/*!
+ * @brief Clear the statistics and start TCB0 counting CLK_PER cycles.
+ *  Call after timebase_init(), which borrows TCB0
+ *
+ * @param None
+ *
+ * @return None
+ */
+void bench_init(void)
+{
+   uint8_t id;
+
+   for (id = 0; id < bench_id_count; id++)
+   {
+      benchStats[id].minCycles = 0xFFFF;
+      benchStats[id].maxCycles = 0;
+      benchStats[id].totalCycles = 0;
+      benchStats[id].runs = 0;
+      benchStats[id].overflows = 0;
+   }
+
+   benchWraps = 0;
+   TCB0.CTRLB = TCB_CNTMODE_INT_gc;
+   TCB0.CCMP = 0xFFFF;
+   TCB0.CNT = 0;
+   TCB0.INTFLAGS = TCB_CAPT_bm;
+   TCB0.INTCTRL = TCB_CAPT_bm;
+   TCB0.CTRLA = TCB_CLKSEL_CLKDIV1_gc | TCB_ENABLE_bm;
+
+   // time an empty region so the host can take the cost of measuring back out
+   BENCH_START(stamp);
+   BENCH_STOP(stamp, bench_id_overhead);
+}
+
+/*!
+ * @brief Read the free-running cycle counter, extended to 32 bits by the wraps counted so far.
+ *  The 16 bit read goes through the shared TEMP register, so it must not be split by an ISR that reads it too
+ *
+ * @param None
+ *
+ * @return The TCB0 wraps in the high half and the current TCB0 count in the low half
+ */
+uint32_t bench_now(void)
+{
+   uint16_t now;
+   uint16_t wraps;
+
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      now = TCB0.CNT;
+      wraps = benchWraps;
+      // wrapped but not yet counted, from inside another ISR or here; a count near the top was read just before the wrap
+      if ((TCB0.INTFLAGS & TCB_CAPT_bm) && (now < 0x8000)) wraps++;
+   }
+   return ((uint32_t) wraps << 16) | now;
+}
+
+/*!
+ * @brief Add one run of an instrumented region to its statistics
+ *
+ * @param id
+ *  The region that was timed
+ *
+ * @param cycles
+ *  How many CLK_PER cycles the run took, saturated to 0xFFFF and counted as an overflow if more
+ *
+ * @return None
+ */
+void bench_record(bench_id_t id, uint32_t cycles)
+{
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      bench_stat_t *stat = &benchStats[id];
+
+      if (cycles > 0xFFFF)
+      {
+         cycles = 0xFFFF;
+         stat->overflows++;
+      }
+      if (cycles < stat->minCycles) stat->minCycles = cycles;
+      if (cycles > stat->maxCycles) stat->maxCycles = cycles;
+      stat->totalCycles += cycles;
+      stat->runs++;
+   }
+}
+
+/*!
+ * @brief Record the RTC cycles since timebase_init() started the RTC as the boot time.
+ *  Call once the board is armed, within the two seconds it takes RTC.CNT to wrap
+ *
+ * @param None
+ *
+ * @return None
+ */
+void bench_boot(void)
+{
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      benchBootRtcCycles = RTC.CNT;
+   }
+}
+
+/*!
+ * @ingroup ISRs
+ * @brief TCB0 wrapped, count it for the high half of bench_now()
+ *
+ * @param TCB0_INT_vect
+ *  Unused parameter required by interface
+ *
+ * @return None
+ */
+ISR(TCB0_INT_vect)
+{
+   TCB0.INTFLAGS = TCB_CAPT_bm;
+   benchWraps++;
+}
+
+#endif /* BENCHMARK */
@@ -0,0 +1,69 @@
+/*!
+ * @file bench.h
+ *
+ * Created: 10/16/2026
+ *
+ * Cycle counting instrumentation for the BENCHMARK build. Each instrumented region keeps a
+ * min/max/total in benchStats[], with runs too long for 16 bits saturated and counted, and the boot time is kept in benchBootRtcCycles, which
+ * Scripts/Linux/benchmark.py reads back over UPDI.
+ * Without BENCHMARK defined the macros compile to nothing.
+ *
+ */
+
+#include "stdint.h"
+#include "main.h"
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+/** Code regions timed in the benchmark build, each with one bench_stat_t in benchStats[] */
+typedef enum bench_id_enum
+{
+   bench_id_overhead,  ///< An empty BENCH_START()/BENCH_STOP() pair, the cost of measuring itself
+   bench_id_audio_isr,  ///< ISR(TCA0_LUNF_vect), once per PWM period while audio plays
+   bench_id_audio_fill,  ///< audio_fill(), topping up the audio ring buffer
+   bench_id_rtc_isr,  ///< ISR(RTC_CNT_vect), once per msec while I2C is busy else once per tick, including onTick()
+   bench_id_twi_isr,  ///< ISR(TWI0_TWIM_vect), once per I2C byte
+   bench_id_sevenseg_write,  ///< writeSevenSeg(), queueing the changed digits
+   bench_id_loop_first,  ///< Main loop pass from wakeup to sleep in the first board_state_t, followed by one per state
+   bench_id_count = bench_id_loop_first + board_state_count
+} bench_id_t;
+
+/** Cycle statistics of one instrumented region */
+typedef struct bench_stat_struct
+{
+   uint16_t minCycles;  ///< Shortest run seen, 0xFFFF until the first run
+   uint16_t maxCycles;  ///< Longest run seen, 0xFFFF if any run overflowed
+   uint32_t totalCycles;  ///< Sum of all runs, for the mean, overflowed runs counting as 0xFFFF
+   uint32_t runs;  ///< Number of runs recorded
+   uint16_t overflows;  ///< Runs longer than 0xFFFF cycles, e.g. a region that slept, recorded as 0xFFFF
+} bench_stat_t;
+
+#ifdef BENCHMARK
+
+/** Declare 'stamp' and load it with the current CLK_PER cycle count */
+#define BENCH_START(stamp) uint32_t stamp = bench_now()
+
+/** Record the CLK_PER cycles since BENCH_START(stamp) under 'id' */
+#define BENCH_STOP(stamp, id) bench_record((id), bench_now() - (stamp))
+
+/** Record how long the board took from timebase_init() to being armed */
+#define BENCH_BOOT() bench_boot()
+
+extern bench_stat_t benchStats[bench_id_count];
+extern uint16_t benchBootRtcCycles;
+
+void bench_init(void);
+uint32_t bench_now(void);
+void bench_record(bench_id_t id, uint32_t cycles);
+void bench_boot(void);
+
+#else
+
+#define BENCH_START(stamp)
+#define BENCH_STOP(stamp, id)
+#define BENCH_BOOT()
+
+#endif /* BENCHMARK */
+
+#endif /* BENCH_H_ */
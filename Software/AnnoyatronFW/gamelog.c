@@ -0,0 +1,217 @@
+/*!
+ * @file gamelog.c
+ *
+ * Per-unit game statistics in EEPROM
+ *
+ * Every record holds the running totals, so only the newest one matters. Each save goes into the slot
+ * after the newest, one EEPROM page per slot, so the writes go round GAMELOG_SLOTS pages evenly rather
+ * than wearing out one. A record torn by a power cut fails its checksum, and the one before it is
+ * taken as the newest instead.
+ *
+ * Saving only loads the record into the NVMCTRL page buffer and starts the page write, from the EEPROM
+ * ready interrupt so it never waits for an earlier write to finish. The NVMCTRL then programs the page
+ * by itself over the next few msec, whether the CPU runs or sleeps, and nothing else is held up.
+ *
+ */
+
+#include "gamelog.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/eeprom.h>
+#include <util/atomic.h>
+
+#if (GAMELOG_SLOTS < 2)
+#error "The ring needs at least two EEPROM pages to level the wear"
+#endif
+
+static uint8_t checksum(const gamelog_record_t *record);
+static uint16_t slotAddress(uint8_t slot);
+
+static gamelog_record_t totals;  ///< Totals so far, saved as the next record
+static gamelog_record_t pending;  ///< Record waiting for the EEPROM ready interrupt to write it
+static uint16_t pendingAddress;  ///< EEPROM address pending goes to
+static uint8_t nextSlot;  ///< Slot after the newest record, which the next save goes into
+
+/*!
+ * @brief Load the totals from the newest valid record in the ring, or start from zero if there is none
+ *
+ * @param None
+ *
+ * @return None
+ */
+void gamelog_init(void)
+{
+   gamelog_record_t record;
+   bool isFound = false;
+   uint8_t slot;
+   uint8_t idx;
+
+   nextSlot = 0;
+   for (slot = 0; slot < GAMELOG_SLOTS; slot++)
+   {
+      eeprom_read_block(&record, (const void *) slotAddress(slot), sizeof(record));
+      if (record.checksum != checksum(&record))
+      {
+         continue;
+      }
+
+      // the sequence wraps, but the ring never holds more records than half its range
+      if (!isFound || ((int8_t) (record.sequence - totals.sequence) > 0))
+      {
+         totals = record;
+         nextSlot = (slot + 1) % GAMELOG_SLOTS;
+         isFound = true;
+      }
+   }
+
+   if (!isFound)
+   {
+      totals.sequence = 0;
+      totals.arms = 0;
+      totals.wins = 0;
+      totals.losses = 0;
+      totals.timeouts = 0;
+      for (idx = 0; idx < NUM_CUT_WIRES; idx++)
+      {
+         totals.wrongWires[idx] = 0;
+      }
+      totals.cutCentis = 0;
+   }
+}
+
+/*!
+ * @brief Count the board being armed
+ *
+ * @param None
+ *
+ * @return None
+ */
+void gamelog_armed(void)
+{
+   totals.arms++;
+}
+
+/*!
+ * @brief Count a game won
+ *
+ * @param cutCentis
+ *  Centiseconds from the countdown starting to the winning cut
+ *
+ * @return None
+ */
+void gamelog_win(uint16_t cutCentis)
+{
+   totals.wins++;
+   totals.cutCentis += cutCentis;
+}
+
+/*!
+ * @brief Count a game lost to a wrong cut
+ *
+ * @param wire
+ *  Index of the wrong wire that was cut
+ *
+ * @param cutCentis
+ *  Centiseconds from the countdown starting to the wire being cut
+ *
+ * @return None
+ */
+void gamelog_loss(uint8_t wire, uint16_t cutCentis)
+{
+   totals.losses++;
+   totals.wrongWires[wire]++;
+   totals.cutCentis += cutCentis;
+}
+
+/*!
+ * @brief Count a game lost to the countdown running out
+ *
+ * @param None
+ *
+ * @return None
+ */
+void gamelog_timeout(void)
+{
+   totals.timeouts++;
+}
+
+/*!
+ * @brief Queue the totals to be written as the newest record, and return without waiting for the EEPROM
+ *
+ * @param None
+ *
+ * @return None
+ */
+void gamelog_save(void)
+{
+   totals.sequence++;
+   totals.checksum = checksum(&totals);
+
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      pending = totals;
+      pendingAddress = slotAddress(nextSlot);
+      NVMCTRL.INTCTRL = NVMCTRL_EEREADY_bm;
+   }
+   nextSlot = (nextSlot + 1) % GAMELOG_SLOTS;
+}
+
+/*!
+ * @brief Sum every byte of a record before its checksum
+ *
+ * @param record
+ *  The record to check or seal
+ *
+ * @return The checksum the record should carry
+ */
+static uint8_t checksum(const gamelog_record_t *record)
+{
+   const uint8_t *bytes = (const uint8_t *) record;
+   uint8_t sum = GAMELOG_CHECKSUM_SEED;
+   uint8_t idx;
+
+   for (idx = 0; idx < sizeof(*record) - 1; idx++)
+   {
+      sum += bytes[idx];
+   }
+   return sum;
+}
+
+/*!
+ * @brief Return the EEPROM address of a slot in the ring
+ *
+ * @param slot
+ *  Slot index, below GAMELOG_SLOTS
+ *
+ * @return Address from the start of EEPROM
+ */
+static uint16_t slotAddress(uint8_t slot)
+{
+   return (uint16_t) (GAMELOG_FIRST_PAGE + slot) * EEPROM_PAGE_SIZE;
+}
+
+/*!
+ * @ingroup ISRs
+ * @brief EEPROM ready interrupt, loads the pending record into the page buffer and starts the page write.
+ *  Disables itself until gamelog_save() queues another record
+ *
+ * @param NVMCTRL_EE_vect
+ *  Unused parameter required by interface
+ *
+ * @return None
+ */
+ISR(NVMCTRL_EE_vect)
+{
+   volatile uint8_t *page = (volatile uint8_t *) (EEPROM_START + pendingAddress);
+   const uint8_t *bytes = (const uint8_t *) &pending;
+   uint8_t idx;
+
+   // only the bytes loaded into the page buffer are erased and written, the rest of the page is untouched
+   for (idx = 0; idx < sizeof(pending); idx++)
+   {
+      page[idx] = bytes[idx];
+   }
+   _PROTECTED_WRITE_SPM(NVMCTRL.CTRLA, NVMCTRL_CMD_PAGEERASEWRITE_gc);
+   NVMCTRL.INTCTRL = 0;
+}
@@ -0,0 +1,42 @@
+/*!
+ * @file gamelog.h
+ *
+ * Created: 10/16/2026
+ *
+ * Definitions and prototypes for the per-unit game statistics, kept in a wear-leveled ring of
+ * records in EEPROM. The record layout must match Scripts/Linux/gamestats.py
+ *
+ */
+
+#include "stdint.h"
+#include "main.h"
+
+#ifndef GAMELOG_H_
+#define GAMELOG_H_
+
+#define GAMELOG_FIRST_PAGE 1  ///< First EEPROM page of the ring, page 0 is left to random.c's RANDOM_SEED_ADDRESS
+#define GAMELOG_SLOTS (EEPROM_SIZE / EEPROM_PAGE_SIZE - GAMELOG_FIRST_PAGE)  ///< Records in the ring, one per EEPROM page
+#define GAMELOG_CHECKSUM_SEED 0x5A  ///< Starting value of the checksum, so neither an erased nor a zeroed record passes
+
+/** Running totals since the unit was first programmed, the newest record in the ring holds the latest. Must fit in an EEPROM page */
+typedef struct gamelog_record_struct
+{
+   uint8_t sequence;  ///< One more than the record before it in the ring, wrapping
+   uint16_t arms;  ///< Times the board was armed, at boot and after every wire setup
+   uint16_t wins;  ///< Games won by cutting the wires the rule asked for
+   uint16_t losses;  ///< Games lost by cutting a wrong wire
+   uint16_t timeouts;  ///< Games lost by letting the countdown run out
+   uint16_t wrongWires[NUM_CUT_WIRES];  ///< Losses by the index of the wrong wire cut
+   uint32_t cutCentis;  ///< Countdown time before the cut, summed over every win and loss, in centiseconds
+   uint8_t checksum;  ///< GAMELOG_CHECKSUM_SEED plus every byte before it
+} gamelog_record_t;
+
+void gamelog_init(void);
+void gamelog_armed(void);
+void gamelog_win(uint16_t cutCentis);
+void gamelog_loss(uint8_t wire, uint16_t cutCentis);
+void gamelog_timeout(void);
+void gamelog_save(void);
+
+
+#endif /* GAMELOG_H_ */
@@ -0,0 +1,137 @@
+/*!
+ * @file gamemode.c
+ *
+ * Game modes and the rule tables they deal from
+ *
+ * The cut wires shifted down to bit 0 make a number from 0 to 15, and each rule keeps one bit per such
+ * number: set in properCuts if that set of cut wires wins, set in partialCuts if it is a safe start. An
+ * ordered sequence is a chain of partial sets each one wire bigger than the last, since cutWires only
+ * ever grows and every cut is judged as it happens, so the wrong order reaches a set that is in neither.
+ * The tables are worked out here at compile time, and judging is the same bit test for every mode.
+ *
+ */
+
+#include "gamemode.h"
+#include "random.h"
+
+#define ALL_WIRES (GAMEMODE_WIRE(1) | GAMEMODE_WIRE(2) | GAMEMODE_WIRE(3) | GAMEMODE_WIRE(4))  ///< Every wire slot in play
+#define FIRST_THREE (GAMEMODE_WIRE(1) | GAMEMODE_WIRE(2) | GAMEMODE_WIRE(3))  ///< Wires 1 to 3 in play
+
+/** Cut only wire 'safe' out of the wires in 'wires' */
+#define RULE_ONE(wires, safe) \
+   {(wires), GAMEMODE_CUTS(GAMEMODE_WIRE(safe)), GAMEMODE_CUTS(0), (safe) * 0x1111}
+
+/** Cut wire 'first', then wire 'second' */
+#define RULE_SEQUENCE(first, second) \
+   {ALL_WIRES, GAMEMODE_CUTS(GAMEMODE_WIRE(first) | GAMEMODE_WIRE(second)), \
+    GAMEMODE_CUTS(0) | GAMEMODE_CUTS(GAMEMODE_WIRE(first)), ((first) << 12) | (second)}
+
+/** Cut any two of wires 'a', 'b' and 'c', the fourth loses */
+#define RULE_ANY_TWO(a, b, c) \
+   {ALL_WIRES, GAMEMODE_CUTS(GAMEMODE_WIRE(a) | GAMEMODE_WIRE(b)) | GAMEMODE_CUTS(GAMEMODE_WIRE(a) | GAMEMODE_WIRE(c)) \
+               | GAMEMODE_CUTS(GAMEMODE_WIRE(b) | GAMEMODE_WIRE(c)), \
+    GAMEMODE_CUTS(0) | GAMEMODE_CUTS(GAMEMODE_WIRE(a)) | GAMEMODE_CUTS(GAMEMODE_WIRE(b)) | GAMEMODE_CUTS(GAMEMODE_WIRE(c)), \
+    ((a) << 12) | ((b) << 8) | ((c) << 4)}
+
+static const game_rule_t classicRules[] =
+{
+   RULE_ONE(ALL_WIRES, 1), RULE_ONE(ALL_WIRES, 2), RULE_ONE(ALL_WIRES, 3), RULE_ONE(ALL_WIRES, 4),
+};
+
+static const game_rule_t threeWireRules[] =
+{
+   RULE_ONE(FIRST_THREE, 1), RULE_ONE(FIRST_THREE, 2), RULE_ONE(FIRST_THREE, 3),
+};
+
+static const game_rule_t sequenceRules[] =
+{
+   RULE_SEQUENCE(1, 2), RULE_SEQUENCE(1, 3), RULE_SEQUENCE(1, 4),
+   RULE_SEQUENCE(2, 1), RULE_SEQUENCE(2, 3), RULE_SEQUENCE(2, 4),
+   RULE_SEQUENCE(3, 1), RULE_SEQUENCE(3, 2), RULE_SEQUENCE(3, 4),
+   RULE_SEQUENCE(4, 1), RULE_SEQUENCE(4, 2), RULE_SEQUENCE(4, 3),
+};
+
+static const game_rule_t anyTwoRules[] =
+{
+   RULE_ANY_TWO(2, 3, 4), RULE_ANY_TWO(1, 3, 4), RULE_ANY_TWO(1, 2, 4), RULE_ANY_TWO(1, 2, 3),
+};
+
+/** Rules to deal from and how many there are, indexed by game_mode_t */
+static const struct
+{
+   const game_rule_t *rules;  ///< The mode's rule table
+   uint8_t count;  ///< Rules in the table
+} modes[game_mode_count] =
+{
+   [game_mode_classic]     = {classicRules, sizeof(classicRules) / sizeof(classicRules[0])},
+   [game_mode_three_wires] = {threeWireRules, sizeof(threeWireRules) / sizeof(threeWireRules[0])},
+   [game_mode_sequence]    = {sequenceRules, sizeof(sequenceRules) / sizeof(sequenceRules[0])},
+   [game_mode_any_two]     = {anyTwoRules, sizeof(anyTwoRules) / sizeof(anyTwoRules[0])},
+};
+
+/** GAMEMODE_CUTS() of every set of cut wires, so gamemode_judge() looks the bit up rather than shifting by a variable amount one bit at a time */
+static const uint16_t cutsBit[16] =
+{
+   GAMEMODE_CUTS(0), GAMEMODE_CUTS(1), GAMEMODE_CUTS(2), GAMEMODE_CUTS(3),
+   GAMEMODE_CUTS(4), GAMEMODE_CUTS(5), GAMEMODE_CUTS(6), GAMEMODE_CUTS(7),
+   GAMEMODE_CUTS(8), GAMEMODE_CUTS(9), GAMEMODE_CUTS(10), GAMEMODE_CUTS(11),
+   GAMEMODE_CUTS(12), GAMEMODE_CUTS(13), GAMEMODE_CUTS(14), GAMEMODE_CUTS(15),
+};
+
+static const game_rule_t *rule = &classicRules[0];  ///< Rule of the game being played
+
+/*!
+ * @brief Deal a rule at random from 'mode' for the games until the next reset.
+ *  Call after random_init()
+ *
+ * @param mode
+ *  The mode to deal from
+ *
+ * @return None
+ */
+void gamemode_deal(game_mode_t mode)
+{
+   rule = &modes[mode].rules[random_below(modes[mode].count)];
+}
+
+/*!
+ * @brief Return the wires in play
+ *
+ * @param None
+ *
+ * @return PORTA bit mask of the wires in play, a subset of CUT_WIRES_bm
+ */
+uint8_t gamemode_wires(void)
+{
+   return rule->wires << GAMEMODE_WIRES_SHIFT;
+}
+
+/*!
+ * @brief Return what to show the player of the rule
+ *
+ * @param None
+ *
+ * @return Wire numbers one per nibble from the left, zero for a blank digit
+ */
+uint16_t gamemode_hint(void)
+{
+   return rule->hint;
+}
+
+/*!
+ * @brief Judge a set of cut wires against the rule. Short enough for the PORTA ISR
+ *
+ * @param cutWires
+ *  PORTA bit mask of the wires cut so far, only wires in play
+ *
+ * @return game_event_proper_cut if they win, game_event_partial_cut if the game goes on,
+ *  else game_event_wrong_cut
+ */
+game_event_t gamemode_judge(uint8_t cutWires)
+{
+   uint16_t cuts = cutsBit[cutWires >> GAMEMODE_WIRES_SHIFT];
+
+   if (rule->properCuts & cuts) return game_event_proper_cut;
+   if (rule->partialCuts & cuts) return game_event_partial_cut;
+   return game_event_wrong_cut;
+}
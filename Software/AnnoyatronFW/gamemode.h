@@ -0,0 +1,56 @@
+/*!
+ * @file gamemode.h
+ *
+ * Created: 10/16/2026
+ *
+ * Definitions and prototypes for the game modes. A mode is a table of rules, and each game one rule
+ * is dealt from it at random. A rule lists, as one bit per set of wires, which sets of cut wires win and
+ * which are a safe start, so any rule is judged with the same mask test however many wires it needs
+ * cut or in what order
+ *
+ */
+
+#include "stdint.h"
+#include "main.h"
+
+#ifndef GAMEMODE_H_
+#define GAMEMODE_H_
+
+/** Wire n, counted from 1 as on the board, as a bit of the cut wires shifted down to bit 0 */
+#define GAMEMODE_WIRE(n) (1 << ((n) - 1))
+
+/** Bit standing for exactly the wires in 'wires' being cut, 'wires' made of GAMEMODE_WIRE() bits. For the tables built at compile time, see cutsBit in gamemode.c */
+#define GAMEMODE_CUTS(wires) (1U << (wires))
+
+#define GAMEMODE_WIRES_SHIFT 4  ///< Bit of PORTA wire 1 is on, see cut_wire_pos_array
+
+/** The rule sets to deal from */
+typedef enum game_mode_enum
+{
+   game_mode_classic,  ///< Four wires, cut the one safe wire
+   game_mode_three_wires,  ///< Wires 1 to 3 only, cut the one safe wire, wire 4 is left out
+   game_mode_sequence,  ///< Four wires, cut two safe wires in the order given
+   game_mode_any_two,  ///< Four wires, cut any two of the three safe ones
+   game_mode_count  ///< Number of modes, not a mode itself
+} game_mode_t;
+
+#ifndef GAME_MODE
+#define GAME_MODE game_mode_classic  ///< Mode every game is dealt from, override with -DGAME_MODE=game_mode_...
+#endif
+
+/** One way to win a game */
+typedef struct game_rule_struct
+{
+   uint8_t wires;  ///< GAMEMODE_WIRE() bits of the wires in play, the others are ignored and need not be plugged in
+   uint16_t properCuts;  ///< GAMEMODE_CUTS() bits of every set of cut wires that wins
+   uint16_t partialCuts;  ///< GAMEMODE_CUTS() bits of every set of cut wires that is a safe start, anything else loses
+   uint16_t hint;  ///< Wires shown to the player, one per nibble from the left with zero for a blank, as for the countdown
+} game_rule_t;
+
+void gamemode_deal(game_mode_t mode);
+uint8_t gamemode_wires(void);
+uint16_t gamemode_hint(void);
+game_event_t gamemode_judge(uint8_t cutWires);
+
+
+#endif /* GAMEMODE_H_ */
@@ -30,19 +30,41 @@
  * @section source_code Source Code 
  * <a href="https://github.com/ChaseStewart/AVR-Annoyatron">AVR-Annoyatron on GitHub</a>
  */
-#include "audio/audioArrays.h"
 #include "main.h"
+#include "Audio.h"
+#include "siren.h"
+#include "spiflash.h"
 #include "I2C.h"
 #include "SevenSeg.h"
 #include "random.h"
+#include "Timebase.h"
+#include "bench.h"
+#include "power.h"
+#include "gamelog.h"
+#include "trace.h"
+#include "gamemode.h"
  
-#define __DELAY_BACKWARD_COMPATIBLE__  //< Required to be defined for delay_msec to work
-#include <util/delay.h>
 #include <stdbool.h>
 #include <xc.h>
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <avr/sleep.h>
+#include <util/atomic.h>
+#include <stddef.h>
+
+/* the shared counters below are sized to fit these, with no room to spare for 32 bit arithmetic */
+#if (PIR_HIGH_COUNT_TO_COUNTDOWN > 0xFFFF) || (PIR_LOW_COUNT_TO_SLEEP > 0xFFFF)
+#error "pirQualifyTicks is 16 bits"
+#endif
+#if (BLINK_COUNT_SHORT > 0xFF) || (BLINK_COUNT_LONG > 0xFF)
+#error "blinkCount is 8 bits"
+#endif
+#if (BOOT_BLINK_TICKS > 0xFF) || (BOOT_BLINKS * 2 > 0xFF)
+#error "bootBlinkCount and bootToggles are 8 bits"
+#endif
+#if (SIREN_SPEED_NORMAL + SIREN_SPEEDUP_PER_SEC * BCD_SECONDS(COUNTDOWN_START_BCD) > 0xFF)
+#error "audio_setSirenSpeed() takes 8 bits, lower SIREN_SPEEDUP_PER_SEC"
+#endif
 
 /* static functions */
 static void initPeripherals(void);
@@ -50,28 +72,96 @@ static void initClocks(void);
 static void initCutWires(void);
 static void initPIR(void);
 static void initLED(void);
-static void initAudio(void);
-static void initCountdownTimer(void);
 static void initADC(void);
 static bool PIRisTriggered(void);
 static bool wireIsCut(void);
-static bool properWireIsCut(uint8_t inWire);
-static void setAudioIsEnabled(bool isAudioEnabled);
+static bool wiresAreSettled(void);
 static void setLed(bool isLedSet);
+static void writeHint(uint16_t hint);
+static uint16_t bcdDecrement(uint16_t bcd);
+static uint16_t bcdToBinary(uint16_t bcd);
+static uint16_t centisToCut(void);
+static void onTick(void);
+static void handleEvents(uint8_t events);
+static void dispatchEvent(game_event_t event);
+static void enterState(board_state_t state);
+static void sleepUntilEvent(void);
+static void wireSetupEntry(void);
+static game_event_t wireSetupTick(void);
+static void wireSetupExit(void);
+static void sleepEntry(void);
+static void sleepExit(void);
+static void waitingEntry(void);
+static void waitingExit(void);
+static void pirQualify(void);
+static game_event_t pirSettledEvent(void);
+static void countdownEntry(void);
+static game_event_t countdownTick(void);
+static void successEntry(void);
+static void failureEntry(void);
+static void doneEntry(void);
+
+/** Entry, exit and tick actions of one state, any of which may be NULL */
+typedef struct state_actions_struct
+{
+   void (*entry)(void);  ///< Run once on entering the state
+   void (*exit)(void);  ///< Run once on leaving the state
+   game_event_t (*tick)(void);  ///< Run on every system tick while in the state, returns the game event it raises
+} state_actions_t;
+
+/** What each state does, indexed by board_state_t */
+static const state_actions_t stateActions[board_state_count] =
+{
+   [board_state_wire_setup] = {wireSetupEntry, wireSetupExit, wireSetupTick},
+   [board_state_sleep]      = {sleepEntry, sleepExit, NULL},
+   [board_state_waiting]    = {waitingEntry, waitingExit, NULL},
+   [board_state_countdown]  = {countdownEntry, NULL, countdownTick},
+   [board_state_success]    = {successEntry, NULL, NULL},
+   [board_state_failure]    = {failureEntry, NULL, NULL},
+   [board_state_done]       = {doneEntry, NULL, NULL},
+};
+
+/** Entry in transitionTable moving to 'state', kept off zero so that unlisted events can mean no transition */
+#define GOTO(state) ((state) + 1)
+
+/**
+ * Next state for each game event in each state, indexed by board_state_t then game_event_t.
+ * Zero, i.e. every event not listed, leaves the state alone
+ */
+static const uint8_t transitionTable[board_state_count][game_event_count] =
+{
+   [board_state_wire_setup] = {[game_event_wires_ready] = GOTO(board_state_sleep)},
+   [board_state_sleep]      = {[game_event_motion]      = GOTO(board_state_waiting)},
+   [board_state_waiting]    = {[game_event_proper_cut]  = GOTO(board_state_wire_setup),
+                               [game_event_wrong_cut]   = GOTO(board_state_wire_setup),
+                               [game_event_partial_cut] = GOTO(board_state_wire_setup),
+                               [game_event_motion_held] = GOTO(board_state_countdown),
+                               [game_event_motion_gone] = GOTO(board_state_sleep)},
+   [board_state_countdown]  = {[game_event_proper_cut]  = GOTO(board_state_success),
+                               [game_event_wrong_cut]   = GOTO(board_state_failure),
+                               [game_event_rollover]    = GOTO(board_state_failure)},
+   [board_state_success]    = {[game_event_clip_done]   = GOTO(board_state_done)},
+   [board_state_failure]    = {[game_event_clip_done]   = GOTO(board_state_done)},
+   [board_state_done]       = {0},
+};
 
 /* volatile variables */
-volatile uint32_t audioIdx;  ///< Index into playing audio array from audioArrays.h
-volatile bool ADCResRdy;  ///< True if ADC has results for random sample, else False
-volatile bool counterRollover;  ///< True if countdown time has run out, else False
-volatile uint32_t pirHighCount;  ///< How many times has the PIR sensor consecutively been tripped
-volatile uint32_t pirLowCount;  ///< How many times has the PIR sensor consecutively been tripped
-volatile uint32_t tcbCount;  ///< Countdown timer count that is used to set 7 seg display
+volatile uint8_t pendingEvents;  ///< EVENT_*_bm flags posted by the ISRs and not yet handled by the main loop
+volatile uint8_t cutWires;  ///< Sticky mask of every wire in play the PORTA ISR has seen cut since the wires were last set up
+volatile game_event_t cutResult;  ///< Verdict on the cuts so far, game_event_partial_cut until a cut wins or loses, then latched
+volatile uint8_t wrongCuts;  ///< Wires whose cut lost the game, zero unless cutResult is game_event_wrong_cut
+volatile uint8_t wireQuietTicks;  ///< Ticks since the last cut wire edge, saturating at WIRE_SETTLE_TICKS
+volatile uint16_t countdownBcd;  ///< Countdown time left as packed BCD centiseconds (0x1000 is 10.00s), one display digit per nibble
 volatile board_state_t boardState; ///< Current state enumeration of state machine
-volatile blink_state_t blinkState;  ///< State machine for blinking LED during countdown
-volatile uint32_t blinkCount;  ///< Actual counter value for nonblocking LED blink
+volatile uint8_t bootToggles;  ///< LED toggles left in the boot splash, zero once it is over
+volatile uint16_t pirQualifyTicks;  ///< Ticks the PIR must stay at pirIsHigh before EVENT_PIR_SETTLED_bm is posted, zero once posted or when not waiting
+volatile bool pirIsHigh;  ///< PIR level at its last edge while waiting
 
 /* non-volatile variables */
-uint8_t safeWire;  ///< integer index [0-3] of wire selected to be proper wire
+blink_state_t blinkState;  ///< State machine for blinking LED during countdown, only touched by onTick() once set up
+uint8_t blinkCount;  ///< Actual counter value for nonblocking LED blink, only touched by onTick() once set up
+uint8_t bootBlinkCount;  ///< Ticks until the next boot splash LED toggle, only touched by onTick() once set up
+uint8_t hintWire;  ///< integer index [0-3] of the first wire in the hint, which the LED blinks out in the countdown
 uint8_t cut_wire_pos_array[NUM_CUT_WIRES] = {PIN4_bm, PIN5_bm, PIN6_bm, PIN7_bm};  ///< GPIO bitmask for the wires-to-be-cut
 blink_state_t blinkReloadState[4] = {blink_state_1_high, blink_state_2_high, blink_state_3_high, blink_state_4_high};  ///< Location to restart the blink pattern
 
@@ -83,235 +173,541 @@ blink_state_t blinkReloadState[4] = {blink_state_1_high, blink_state_2_high, bli
  */
 int main(void)
 {
-   audioIdx = 0;
-   pirHighCount = 0;
-   pirLowCount = 0;
-   ADCResRdy = false;
-   counterRollover = false;
-   tcbCount = 10*100;
+   uint8_t events;
+#ifdef BENCHMARK
+   board_state_t loopState;
+#endif
+
+   pirQualifyTicks = 0;
+   pendingEvents = 0;
+   bootToggles = 0;
+   wireQuietTicks = 0;
+   countdownBcd = COUNTDOWN_START_BCD;
    blinkCount = BLINK_COUNT_SHORT;
    initPeripherals();
-   set_sleep_mode(SLEEP_MODE_PWR_DOWN);
-   sei();
+   gamelog_init();
    
-   random_init(adcGetSeed());
-   safeWire = (uint8_t) (random() % NUM_CUT_WIRES);
-   blinkState = blinkReloadState[safeWire];
-   writeAllDigits(safeWire + 1);
-
-   ledUsrBlink(3, 500);
+   random_init(random_gatherEntropy());
+#ifdef AUDIO_SPI_FLASH
+   // PA1 was the floating seed input up to here, from now on it is the external flash's MOSI
+   spiflash_init();
+#endif
+   gamemode_deal(GAME_MODE);
+   hintWire = (uint8_t) (gamemode_hint() >> 12) - 1;
+   blinkState = blinkReloadState[hintWire];
+   wrongCuts = 0;
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      cutWires = PORTA.IN & gamemode_wires();
+      cutResult = cutWires ? gamemode_judge(cutWires) : game_event_partial_cut;
+   }
 
-   writeAllDigits(SEVENSEG_NONE);   
-   TCB0.CTRLA = TCB_ENABLE_bm;
+#ifdef POWER_PROFILE
+   // leave the one-off boot out of the profile
+   power_init();
+#endif
+   enterState(board_state_sleep);
 
-   boardState = board_state_sleep;
-   setLed(false);
-   PORTC.PIN0CTRL |= PORT_ISC_BOTHEDGES_gc;
+   // arm straight away, the tick shows the hint and blinks the LED while we already wait for the PIR
+   writeHint(gamemode_hint());
+   setLed(true);
+   bootBlinkCount = BOOT_BLINK_TICKS;
+   bootToggles = BOOT_BLINKS * 2;
+   gamelog_armed();
+   BENCH_BOOT();
+#ifdef BENCHMARK
+   // the PIR is stubbed to always see motion, so skip waiting for it to wake us as well
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      pendingEvents |= EVENT_PIR_bm;
+   }
+#endif
    
    while(1)
    {
+      BENCH_START(loopStamp);
+#ifdef BENCHMARK
+      loopState = boardState;
+#endif
 
-      switch(boardState)
+      // a stuck or failed I2C transaction is only flagged in the RTC or TWI0 ISR, the bus recovery runs out here
+      I2C_service();
+
+      // take every event posted so far in one go, anything posted after this is left for the next pass
+      ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
       {
-		 case board_state_wire_setup:
-			// waiting for the wires to be plugged in
-			if (!wireIsCut())
-			{
-               sevenSegBlink(HT16K33_BLINK_OFF);
-               writeAllDigits(SEVENSEG_NONE);
-               boardState = board_state_sleep;
-			   pirHighCount = 0;
-			   pirLowCount = 0;
-               setLed(false);
-               PORTC.PIN0CTRL |= PORT_ISC_BOTHEDGES_gc;
-			}
-			break;
-			
-         case board_state_sleep:
-			sleep_mode();
-		    break;
-		 
-         case board_state_waiting:
-		    if (wireIsCut())
-			{
-               sevenSegBlink(HT16K33_BLINK_1HZ);
-               writeAllDigits(SEVENSEG_DASH);
-               boardState = board_state_wire_setup;
-               setLed(false);
-			}
-            break;
-         
-         case board_state_countdown:
-            // Actively update count until wire is cut or counter rolls over
-            setSevenSegValue(0, (tcbCount / 1000) % 10);
-            setSevenSegValue(1, (tcbCount / 100)  % 10);
-            setSevenSegValue(2, 0x02);
-            setSevenSegValue(3, (tcbCount / 10) % 10);
-            setSevenSegValue(4, tcbCount % 10);
-            writeSevenSeg();
-         
-            if (counterRollover)
-            {
-			   audioIdx = 0;
-               boardState = board_state_failure;
-               counterRollover = false;
-               sevenSegBlink(HT16K33_BLINK_2HZ);
-               writeAllDigits(0);
-               TCB0.CTRLA = 0;
-            }
-            else if (wireIsCut())
-            {             
-               if (properWireIsCut(safeWire))
-               {
-				  audioIdx = 0;
-                  boardState = board_state_success;
-                  sevenSegBlink(HT16K33_BLINK_HALFHZ);
-                  writeSevenSeg();
-               }
-               else
-               {
-				  audioIdx = 0;
-                  boardState = board_state_failure;
-                  writeAllDigits(0);
-                  sevenSegBlink(HT16K33_BLINK_2HZ);
-               }
-            }
-            break;
-         
-         case board_state_failure:
-		    if (audioIdx >= sizeof(youLose))
-			{
-				setAudioIsEnabled(false);
-				boardState = board_state_done;
-				setLed(false);
-			}
-            break;
-			
-		case board_state_success:
-		    if (audioIdx >= sizeof(youWin))
-		    {
-			    setAudioIsEnabled(false);
-			    boardState = board_state_done;
-			    setLed(false);
-		    }
-			break;
-			
-         case board_state_done:
-		    // get stuck forever
-			sleep_mode();
-			break;
-		 
-         default:
-            // should never get here!
-            ledUsrBlink(0, 1000);
+         events = pendingEvents;
+         pendingEvents = 0;
       }
+      handleEvents(events);
+
+      BENCH_STOP(loopStamp, bench_id_loop_first + loopState);
+      sleepUntilEvent();
    }
    // should never get here!
    return 0;
 }
 
 /*!
- * @defgroup HardwareInit
- * Functions to initialize the hardware for this project
+ * @brief Turn the events the ISRs have posted into game events and run them through the state machine.
+ *  Game events that mean nothing in the current state are dropped by the transition table
+ *
+ * @param events
+ *  EVENT_*_bm flags taken from pendingEvents
+ *
+ * @return None
+ */
+static void handleEvents(uint8_t events)
+{
+   // top up the audio first, the ISR is already eating into what is left
+   if (events & EVENT_AUDIO_bm)
+   {
+      audio_fill();
+   }
+
+   if (events & EVENT_SPLASH_DONE_bm)
+   {
+      writeAllDigits(SEVENSEG_NONE);
+   }
+
+   if (events & EVENT_PIR_bm)
+   {
+      dispatchEvent(game_event_motion);
+   }
+
+   // the countdown running out beats a cut in the same tick, as it always has
+   if (events & EVENT_ROLLOVER_bm)
+   {
+      dispatchEvent(game_event_rollover);
+   }
+
+   // cuts made while asleep are still latched in cutResult, so look again once the PIR wakes us
+   if ((events & (EVENT_WIRE_bm | EVENT_PIR_bm)) && wireIsCut())
+   {
+      dispatchEvent(cutResult);
+   }
+
+   if (events & EVENT_CLIP_DONE_bm)
+   {
+      dispatchEvent(game_event_clip_done);
+   }
+
+   if (events & EVENT_PIR_SETTLED_bm)
+   {
+      dispatchEvent(pirSettledEvent());
+   }
+
+   if ((events & EVENT_TICK_bm) && stateActions[boardState].tick)
+   {
+      dispatchEvent(stateActions[boardState].tick());
+   }
+}
+
+/*!
+ * @brief Look up one game event in the transition table, and if it leads anywhere run the current state's
+ *  exit action and the next state's entry action
+ *
+ * @param event
+ *  The game event to apply to boardState
+ *
+ * @return None
  */
+static void dispatchEvent(game_event_t event)
+{
+   uint8_t next = transitionTable[boardState][event];
+
+   if (!next) return;
+
+   if (stateActions[boardState].exit)
+   {
+      stateActions[boardState].exit();
+   }
+   enterState((board_state_t) (next - 1));
+}
 
 /*!
- * @ingroup HardwareInit
+ * @brief Make 'state' the current state and run its entry action
  *
- * @brief Setup all peripherals.
+ * @param state
+ *  The state to enter
+ *
+ * @return None
+ */
+static void enterState(board_state_t state)
+{
+   POWER_SET_STATE(state);
+   trace_emit(trace_type_state, (boardState << 4) | state);
+   boardState = state;
+   if (stateActions[state].entry)
+   {
+      stateActions[state].entry();
+   }
+}
+
+/*!
+ * @defgroup StateActions
+ * Entry, exit and tick actions of the states, see stateActions
+ */
+
+/*!
+ * @ingroup StateActions
+ * @brief Prompt for the wires to be plugged back in
  *
  * @param None
  *
  * @return None
  */
-static void initPeripherals(void)
+static void wireSetupEntry(void)
 {
-   initClocks();
-   initCountdownTimer();
-   initLED();
-   initPIR();
-   I2C_init();
-   initSevenSeg();
-   initADC();
-   initAudio();
-   initCutWires();
+   sevenSegBlink(HT16K33_BLINK_1HZ);
+   writeAllDigits(SEVENSEG_DASH);
+   setLed(false);
 }
 
 /*!
- * @ingroup HardwareInit
+ * @ingroup StateActions
+ * @brief Wait for the wires to be plugged in and left alone long enough to stop bouncing
+ *
+ * @param None
  *
- * @brief Setup clock registers.
+ * @return game_event_wires_ready once they have, else game_event_none
+ */
+static game_event_t wireSetupTick(void)
+{
+   return wiresAreSettled() ? game_event_wires_ready : game_event_none;
+}
+
+/*!
+ * @ingroup StateActions
+ * @brief Clear the display and forget the old cuts, the wires are all plugged in again and the board is armed
  *
  * @param None
  *
  * @return None
  */
-static void initClocks(void)
+static void wireSetupExit(void)
 {
-   CLKCTRL.MCLKCTRLA |= CLKCTRL_CLKOUT_bm | CLKCTRL_CLKSEL_OSC20M_gc;
-   CLKCTRL.MCLKCTRLB |= CLKCTRL_PDIV_16X_gc | CLKCTRL_PEN_bm;
+   gamelog_armed();
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      cutWires = 0;
+      cutResult = game_event_partial_cut;
+      wrongCuts = 0;
+   }
+   sevenSegBlink(HT16K33_BLINK_OFF);
+   writeAllDigits(SEVENSEG_NONE);
 }
 
 /*!
- * @ingroup HardwareInit
+ * @ingroup StateActions
+ * @brief Silence everything and let the PIR wake us
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void sleepEntry(void)
+{
+   audio_stop();
+   audio_enable(false);
+   setLed(false);
+   PORTC.PIN0CTRL |= PORT_ISC_BOTHEDGES_gc;
+}
+
+/*!
+ * @ingroup StateActions
+ * @brief Cut the boot splash short if the PIR wakes us before it is over, the hint must not stay on show
  *
- * @brief Startup the timer to measure centi-seconds.
- * TODO get CCMP just right, validate with scope
+ * @param None
+ *
+ * @return None
+ */
+static void sleepExit(void)
+{
+   if (bootToggles)
+   {
+      bootToggles = 0;
+      writeAllDigits(SEVENSEG_NONE);
+   }
+}
+
+/*!
+ * @ingroup StateActions
+ * @brief Time the PIR from its edges rather than sampling it, starting from the level it is at now
  *
  * @param None
  *
  * @return None
  */
-static void initCountdownTimer(void)
+static void waitingEntry(void)
 {
-   TCB0.CTRLB = TCB_CNTMODE_INT_gc;
-   TCB0.INTFLAGS = 1;
-   TCB0.EVCTRL = TCB_CAPTEI_bm;
-   TCB0.INTCTRL = TCB_CAPTEI_bm;
-   TCB0.CNT = 0;
-   TCB0.CCMP = 0xFFFF;
-   TCB0.CTRLA = 0;
+   PORTC.PIN0CTRL |= PORT_ISC_BOTHEDGES_gc;
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      // an edge from here on restarts the timing from the ISR
+      PC0_CLEAR_INTERRUPT_FLAG;
+      pirQualify();
+   }
+   setLed(true);
 }
 
 /*!
- * @ingroup HardwareInit
+ * @ingroup StateActions
+ * @brief Stop timing the PIR, a settled event still pending is dropped by pirSettledEvent()
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void waitingExit(void)
+{
+   PORTC.PIN0CTRL &= ~PORT_ISC_BOTHEDGES_gc;
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      pirQualifyTicks = 0;
+   }
+}
+
+/*!
+ * @brief Restart the wait for the PIR to hold its current level, from an edge or on entering board_state_waiting.
+ *  Call from ISR(PORTC_PORT_vect) or with interrupts off
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void pirQualify(void)
+{
+   pirIsHigh = PIRisTriggered();
+   pirQualifyTicks = pirIsHigh ? PIR_HIGH_COUNT_TO_COUNTDOWN : PIR_LOW_COUNT_TO_SLEEP;
+}
+
+/*!
+ * @brief Turn EVENT_PIR_SETTLED_bm into the game event for the level the PIR held
+ *
+ * @param None
+ *
+ * @return game_event_motion_held or game_event_motion_gone, or game_event_none if the PIR has moved
+ *  since the event was posted or board_state_waiting was left
+ */
+static game_event_t pirSettledEvent(void)
+{
+   game_event_t event = game_event_none;
+
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      if (!pirQualifyTicks && (boardState == board_state_waiting))
+      {
+         event = pirIsHigh ? game_event_motion_held : game_event_motion_gone;
+      }
+   }
+   return event;
+}
+
+/*!
+ * @ingroup StateActions
+ * @brief Start the siren
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void countdownEntry(void)
+{
+   audio_play(audio_clip_siren, audio_mode_loop);
+   audio_enable(true);
+   setLed(false);
+}
+
+/*!
+ * @ingroup StateActions
+ * @brief Show the time left and speed the siren up to match
+ *
+ * @param None
+ *
+ * @return game_event_none, the ISRs post the rollover and cut events
+ */
+static game_event_t countdownTick(void)
+{
+   uint16_t countdown;
+
+   // each BCD nibble is already a display digit, snapshot it so the ISR can't change it halfway through
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      countdown = countdownBcd;
+   }
+   setSevenSegValue(0, countdown >> 12);
+   setSevenSegValue(1, (countdown >> 8) & 0x0F);
+   setSevenSegValue(2, 0x02);
+   setSevenSegValue(3, (countdown >> 4) & 0x0F);
+   setSevenSegValue(4, countdown & 0x0F);
+   writeSevenSeg();
+
+   // wind the siren up as the time runs out
+   audio_setSirenSpeed(SIREN_SPEED_NORMAL + SIREN_SPEEDUP_PER_SEC * (BCD_SECONDS(COUNTDOWN_START_BCD) - BCD_SECONDS(countdown)));
+   return game_event_none;
+}
+
+/*!
+ * @ingroup StateActions
+ * @brief Freeze the time left on the display and play the success clip
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void successEntry(void)
+{
+   gamelog_win(centisToCut());
+   audio_play(audio_clip_win, audio_mode_once);
+   sevenSegBlink(HT16K33_BLINK_HALFHZ);
+   writeSevenSeg();
+}
+
+/*!
+ * @ingroup StateActions
+ * @brief Flash zeros and play the failure clip
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void failureEntry(void)
+{
+   uint8_t wire;
+
+   if (wrongCuts)
+   {
+      for (wire = 0; !(wrongCuts & cut_wire_pos_array[wire]); wire++);
+      gamelog_loss(wire, centisToCut());
+   }
+   else
+   {
+      // a safe cut in the very tick the time ran out still lost to the clock
+      gamelog_timeout();
+   }
+
+   audio_play(audio_clip_lose, audio_mode_once);
+   sevenSegBlink(HT16K33_BLINK_2HZ);
+   writeAllDigits(0);
+}
+
+/*!
+ * @ingroup StateActions
+ * @brief The clip has played out, shut the amplifier down for good and log the game
+ *
+ * @param None
  *
- * @brief Setup the TCA0 timer and PWM output to the audio IC.
- *  Also setup the ~SHDN pin 
+ * @return None
+ */
+static void doneEntry(void)
+{
+   gamelog_save();
+   audio_stop();
+   audio_enable(false);
+   setLed(false);
+}
+
+/*!
+ * @brief Sleep until an ISR posts an event, or return at once if one is already pending.
+ *  PWR_DOWN in the sleep and done states, where only the pins can wake us, STANDBY while waiting,
+ *  in wire setup and during the boot splash where only the RTC tick is needed, and IDLE while TCA0
+ *  plays audio
  *
  * @param None
  *
  * @return None
  */
-static void initAudio(void)
+static void sleepUntilEvent(void)
 {
-   /*
-    *	set Audio ~SHDN pin to output low for now
-    */
-   PORTB.DIRSET = PIN3_bm;
-   setAudioIsEnabled(false);
+   uint8_t sleepMode = SLEEP_MODE_IDLE;
+
+   // the TWI0 and USART0 clocks stop in STANDBY and PWR_DOWN, so idle until queued display writes and trace records are out
+   if (!I2C_is_busy() && !trace_isBusy())
+   {
+      switch (boardState)
+      {
+         case board_state_sleep:
+            // the boot splash blinks from the RTC tick, which stops in PWR_DOWN
+            sleepMode = bootToggles ? SLEEP_MODE_STANDBY : SLEEP_MODE_PWR_DOWN;
+            break;
+
+         case board_state_done:
+            sleepMode = SLEEP_MODE_PWR_DOWN;
+            break;
+
+         case board_state_wire_setup:
+         case board_state_waiting:
+            sleepMode = SLEEP_MODE_STANDBY;
+            break;
+
+         default:
+            break;
+      }
+   }
 
-   /*
-    *	Setup PORTMUX to provide alternate WO1 output
-    */
-   PORTMUX.CTRLC = PORTMUX_TCA01_bm;
+   // check for events with interrupts off, sei only takes effect after sleep_cpu() so a late event still wakes us
+   cli();
+   if (!pendingEvents)
+   {
+      POWER_SLEEP(sleepMode);
+      set_sleep_mode(sleepMode);
+      sleep_enable();
+      sei();
+      sleep_cpu();
+      sleep_disable();
+      POWER_WAKE();
+   }
+   sei();
+}
 
-   /*
-    *	setup underflow interrupt
-    */
-   TCA0.SPLIT.INTCTRL = TCA_SPLIT_LUNF_bm;
+/*!
+ * @defgroup HardwareInit
+ * Functions to initialize the hardware for this project
+ */
 
-   /*
-    *	setup PWM
-    */
-   PORTB.DIRSET = PIN4_bm; // Set PWM pin to output
-   TCA0.SPLIT.CTRLD = TCA_SPLIT_SPLITM_bm; // Enable split mode based on v1.9.9 pinout
-   TCA0.SPLIT.CTRLB |= (TCA_SPLIT_LCMP1EN_bm); // LCMP1 corresponds to our WO1
-   TCA0.SPLIT.LPER  = 0xFF; // use whole 8 bit array
-   TCA0.SPLIT.LCMP1 = 0; // this will be controlled by the audioArray
-   TCA0.SPLIT.CTRLA = (TCA_SPLIT_CLKSEL_DIV2_gc | TCA_SPLIT_ENABLE_bm);
+/*!
+ * @ingroup HardwareInit
+ *
+ * @brief Setup all peripherals.
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void initPeripherals(void)
+{
+   initClocks();
+   timebase_init(onTick);
+   trace_init();
+#ifdef BENCHMARK
+   bench_init();
+#endif
+   sei();  // the I2C queue and its timeouts need the TWI0 and RTC interrupts from here on
+   initLED();
+   initPIR();
+   I2C_init();
+   initSevenSeg();
+   initADC();
+   audio_init();
+   initCutWires();
 }
 
+/*!
+ * @ingroup HardwareInit
+ *
+ * @brief Run the CPU and peripherals at F_CPU off OSC20M.
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void initClocks(void)
+{
+   // both registers are configuration change protected, a plain write is silently ignored
+   _PROTECTED_WRITE(CLKCTRL.MCLKCTRLA, CLKCTRL_CLKSEL_OSC20M_gc);
+   _PROTECTED_WRITE(CLKCTRL.MCLKCTRLB, CLKCTRL_PDIV_2X_gc | CLKCTRL_PEN_bm);
+}
 
 /*!
  * @ingroup HardwareInit
@@ -331,7 +727,8 @@ static void initPIR(void)
 /*!
  * @ingroup HardwareInit
  *
- * @brief Set up the GPIO for the four cut-wires.
+ * @brief Set up the GPIO for the four cut-wires, with an interrupt on either edge of each.
+ *  BOTHEDGES is the sense mode that can wake the non-asynchronous pins PA4, PA5 and PA7 from PWR_DOWN
  *
  * @param None
  *
@@ -340,10 +737,11 @@ static void initPIR(void)
 static void initCutWires(void)
 {
    PORTA.DIRCLR = CUT_WIRES_bm;
-   PORTA.PIN4CTRL = PORT_PULLUPEN_bm;
-   PORTA.PIN5CTRL = PORT_PULLUPEN_bm;
-   PORTA.PIN6CTRL = PORT_PULLUPEN_bm;
-   PORTA.PIN7CTRL = PORT_PULLUPEN_bm;
+   PORTA.PIN4CTRL = PORT_PULLUPEN_bm | PORT_ISC_BOTHEDGES_gc;
+   PORTA.PIN5CTRL = PORT_PULLUPEN_bm | PORT_ISC_BOTHEDGES_gc;
+   PORTA.PIN6CTRL = PORT_PULLUPEN_bm | PORT_ISC_BOTHEDGES_gc;
+   PORTA.PIN7CTRL = PORT_PULLUPEN_bm | PORT_ISC_BOTHEDGES_gc;
+   PORTA.INTFLAGS = CUT_WIRES_bm;
 }
 
 /*!
@@ -363,7 +761,8 @@ static void initLED(void)
 /*!
  * @ingroup HardwareInit
  *
- * @brief Setup ADC to get random sample.
+ * @brief Setup ADC to sample the floating PA1 for random_gatherEntropy(), which polls it and turns it off.
+ *  CLK_ADC at F_CPU / 8 is in range for full 10 bit resolution, whose low bits are the noise wanted
  *
  * @param None
  *
@@ -371,9 +770,9 @@ static void initLED(void)
  */
 static void initADC(void)
 {
+   ADC0.CTRLC = ADC_PRESC_DIV8_gc | ADC_REFSEL_VDDREF_gc;
    ADC0.MUXPOS = ADC_MUXPOS_AIN1_gc;
    ADC0.CTRLA |= ADC_ENABLE_bm;
-   ADC0.INTCTRL = ADC_RESRDY_bm;
 }
 
 /*!
@@ -383,20 +782,45 @@ static void initADC(void)
 
 /*!
  * @ingroup ISRs
- * @brief Timer Interrupt for countdown timer TCB0.
+ * @brief System tick handler, called from the RTC interrupt every centisecond. Runs the boot splash,
+ *  the PIR timing, the countdown and LED blink pattern, and posts the tick, splash done, PIR settled
+ *  and rollover events.
  *
- * @param TCB0_INT_vect 
- *  Unused parameter required by interface
+ * @param None
  *
  * @return None
  */
-ISR(TCB0_INT_vect)
+static void onTick(void)
 {
-   TCB0.INTFLAGS = 1;
+   pendingEvents |= EVENT_TICK_bm;
+
+   if (wireQuietTicks < WIRE_SETTLE_TICKS)
+   {
+      wireQuietTicks++;
+   }
+
+   // the PIR has held its level since its last edge for long enough
+   if (pirQualifyTicks && !--pirQualifyTicks)
+   {
+      pendingEvents |= EVENT_PIR_SETTLED_bm;
+   }
+
+   if (bootToggles && !--bootBlinkCount)
+   {
+      bootBlinkCount = BOOT_BLINK_TICKS;
+      bootToggles--;
+      // the LED started on, so it is on for the even counts left and off for good at zero
+      setLed(bootToggles && !(bootToggles & 1));
+      if (!bootToggles)
+      {
+         pendingEvents |= EVENT_SPLASH_DONE_bm;
+      }
+   }
    
    if (boardState == board_state_countdown)
    {   
-      tcbCount--;
+      // work on a copy, countdownBcd is volatile for the main loop's sake
+      uint16_t countdown = bcdDecrement(countdownBcd);
 	  blinkCount--;
 	  
 	  if (!blinkCount)
@@ -405,7 +829,7 @@ ISR(TCB0_INT_vect)
 		if (blinkState == blink_state_0)
 		{
 			setLed(true);
-			blinkState = blinkReloadState[safeWire];
+			blinkState = blinkReloadState[hintWire];
 			blinkCount = BLINK_COUNT_SHORT;
 		}
 		else if (blinkState == blink_state_1_low)
@@ -420,122 +844,79 @@ ISR(TCB0_INT_vect)
 		}
 	  }
 	  
-      if (tcbCount == 0)
+      if (countdown == 0)
       {
-         counterRollover = true;
-         tcbCount = 10 * 100;
+         pendingEvents |= EVENT_ROLLOVER_bm;
+         countdown = COUNTDOWN_START_BCD;
       }
+      countdownBcd = countdown;
    }      
-   else if (boardState == board_state_waiting)
-   {
-	  /** 
-	   * start counting towards the configured amount of
-	   * PIR detects until proceeding to countdown mode
-	   */
-	  if (PIRisTriggered())
-	  {
-		  pirHighCount += 1;
-		  pirLowCount = 0;
-		  if (pirHighCount >= PIR_HIGH_COUNT_TO_COUNTDOWN)
-		  {
-			  boardState = board_state_countdown;
-			  setAudioIsEnabled(true);
-			  setLed(false);
-		  }
-	  }
-	  /** 
-	   * start counting towards the separately configured amount of
-	   * PIR non-detects until proceeding to PWR_DOWN sleep mode
-	   */
-	  else
-	  {
-		  pirHighCount = 0;
-		  pirLowCount += 1;		  
-		  if (pirLowCount >= PIR_LOW_COUNT_TO_SLEEP)
-		  {
-			  boardState = board_state_sleep;
-			  setAudioIsEnabled(false);
-			  setLed(false);
-              PORTC.PIN0CTRL |= PORT_ISC_BOTHEDGES_gc;
-		  }
-	  }
-   }
 }
 
 /*!
  * @ingroup ISRs
- * @brief TCA interrupt for PWM timer, to load next audio sample into compare register.
- *
- * @param TCA0_LUNF_vect 
- *  Unused parameter required by interface
+ * @brief GPIO interrupt driven by PIR sensor. In sleep mode it wakes the main loop with EVENT_PIR_bm,
+ *  while waiting every edge restarts the timing of how long the PIR holds its level
  * 
+ * @param PORTC_PORT_vect
+ *  Unused parameter required by interface
+ *
  * @return None
  */
-ISR(TCA0_LUNF_vect)
+ISR(PORTC_PORT_vect)
 {
-   TCA0.SPLIT.INTFLAGS = TCA_SPLIT_LUNF_bm;
-   switch (boardState)
+   if (PC0_INTERRUPT)
    {
-      case board_state_countdown:
-         TCA0.SPLIT.LCMP1 = (siren[audioIdx]);
-         audioIdx = (audioIdx < sizeof(siren)) ? audioIdx + 1 : 0;
-		 break; 
-	  case board_state_success:
-         TCA0.SPLIT.LCMP1 = (youWin[audioIdx]);
-         audioIdx = (audioIdx < sizeof(youWin)) ? audioIdx + 1 : audioIdx;
-	     break;
-		 
-	  case board_state_failure:
-         TCA0.SPLIT.LCMP1 = (youLose[audioIdx]);
-         audioIdx = (audioIdx < sizeof(youLose)) ? audioIdx + 1 : audioIdx;
-	     break;
-
-      default:
+	   // clear int flag so we don't repeatedly trigger
+	   PC0_CLEAR_INTERRUPT_FLAG; 
+      trace_emit(trace_type_pir, PIRisTriggered());
+
+      if (boardState == board_state_waiting)
+      {
+         pirQualify();
          return;
+      }
+	   
+	   // disable this interrupt until state machine re-enables later
+	   PORTC.PIN0CTRL &= ~PORT_ISC_BOTHEDGES_gc;
+	   
+	  // the main loop moves on to board_state_waiting
+      pendingEvents |= EVENT_PIR_bm;
+      POWER_PIR_WAKEUP();
    }
 }
 
 /*!
  * @ingroup ISRs
- * @brief ADC interrupt when ADC results are ready to be taken.
- * 
- * @param ADC0_RESRDY_vect
- *  Unused parameter required by interface
+ * @brief GPIO interrupt on any edge of the cut wires, latches which wires in play were cut, judges the
+ *  new cuts against the game rule and posts EVENT_WIRE_bm.
+ *  A cut reads high through the pull-up, and stays latched in cutWires even if the cut end bounces back
  *
- * @return None
- */
-ISR(ADC0_RESRDY_vect)
-{
-   ADC0.INTFLAGS = ADC_RESRDY_bm;
-   ADC0.CTRLA &= !ADC_ENABLE_bm;
-   ADC0.INTCTRL &= !ADC_RESRDY_bm;
-   ADCResRdy = true;
-}
-
-/*!
- * @ingroup ISRs
- * @brief GPIO interrupt driven by PIR sensor when in sleep mode
- * 
- * @param PORTC_PORT_vect
+ * @param PORTA_PORT_vect
  *  Unused parameter required by interface
  *
  * @return None
  */
-ISR(PORTC_PORT_vect)
+ISR(PORTA_PORT_vect)
 {
-   if (PC0_INTERRUPT)
-   {
-	   // clear int flag so we don't repeatedly trigger
-	   PC0_CLEAR_INTERRUPT_FLAG; 
-	   
-	   // disable this interrupt until state machine re-enables later
-	   PORTC.PIN0CTRL &= ~PORT_ISC_BOTHEDGES_gc;
-	   
-	  // wake up to board_state_waiting
-      boardState = board_state_waiting;
-	  setLed(true);
+   uint8_t changed = PORTA.INTFLAGS & CUT_WIRES_bm;
+   uint8_t newCuts = PORTA.IN & gamemode_wires() & ~cutWires;
+
+   PORTA.INTFLAGS = changed;
+   cutWires |= newCuts;
+   trace_emit(trace_type_wire, cutWires);
 
+   // judge every cut as it comes, so a sequence cut in the wrong order has lost before the next cut
+   if (newCuts && (cutResult == game_event_partial_cut))
+   {
+      cutResult = gamemode_judge(cutWires);
+      if (cutResult == game_event_wrong_cut)
+      {
+         wrongCuts = newCuts;
+      }
    }
+   wireQuietTicks = 0;
+   pendingEvents |= EVENT_WIRE_bm;
 }
 
 /*!
@@ -547,20 +928,19 @@ ISR(PORTC_PORT_vect)
  */
 static bool wireIsCut(void)
 {
-   return PORTA.IN & CUT_WIRES_bm; // anything > 0 means a wire is cut
+   return cutWires; // anything > 0 means a wire is cut
 }
 
 /*!
- * @brief Return whether only the proper wire was cut out of all wires.
+ * @brief Return whether all wires in play are plugged in and have not bounced for WIRE_SETTLE_TICKS.
  *
- * @param inWire
- *  The current state of cut and un-cut wires
+ * @param None
  *
- * @return True if only the designated success wire is cut, else false
+ * @return True if the wires are ready for a new game, else False
  */
-static bool properWireIsCut(uint8_t inWire)
+static bool wiresAreSettled(void)
 {
-   return  ((PORTA.IN & CUT_WIRES_bm) == cut_wire_pos_array[inWire]);
+   return (wireQuietTicks >= WIRE_SETTLE_TICKS) && !(PORTA.IN & gamemode_wires());
 }
 
 /*!
@@ -583,6 +963,29 @@ static void setLed(bool isLedSet)
 	}
 }
 
+/*!
+ * @brief Show the game rule's hint, one wire number per digit with the colon off
+ *
+ * @param hint
+ *  Wire numbers one per nibble from the left, zero for a blank digit, see gamemode_hint()
+ *
+ * @return None
+ */
+static void writeHint(uint16_t hint)
+{
+   static const uint8_t digitIndex[4] = {0, 1, 3, 4};  // display_buffer positions of the digits, skipping the colon
+   uint8_t digit;
+   uint8_t wire;
+
+   setSevenSegValue(2, SEVENSEG_NONE);
+   for (digit = 0; digit < 4; digit++, hint <<= 4)
+   {
+      wire = hint >> 12;
+      setSevenSegValue(digitIndex[digit], wire ? (sevenseg_digit_t) wire : SEVENSEG_NONE);
+   }
+   writeSevenSeg();
+}
+
 /*!
  * @brief Return whether PIR sensor digital output is high at this moment.
  * 
@@ -592,51 +995,68 @@ static void setLed(bool isLedSet)
  */
 static bool PIRisTriggered(void)
 {
+#ifdef BENCHMARK
+   return true;  // stubbed so a benchmark run plays through without anyone moving in front of the board
+#else
    return 0 != (PORTC.IN & PIN0_bm);
+#endif
 }
 
 /*!
- * @brief Blink usr LED 'count'-many times at a period of 2 * 'blinkPeriodMsec'.
- *  NOTE: This is a blocking call!
- * 
- * @param count
- *  The number of times for the LED to blink- set to zero for infinite repetitions
- *  
- * @param blinkPeriodMsec
- *  The period between LED toggles in Msec
+ * @brief Subtract one from a four digit packed BCD value, borrowing from digit to digit.
+ *  Replaces the 32 bit division the display used to need to split a binary count into digits
+ *
+ * @param bcd
+ *  The packed BCD value to decrement, must not be zero
+ *
+ * @return bcd - 1, still packed BCD
  */
-void ledUsrBlink(uint8_t count, const int blinkPeriodMsec)
+static uint16_t bcdDecrement(uint16_t bcd)
 {
-   uint8_t iter=0;
-
-   while (!count || iter < count)
+   // decrement in binary, then every nibble that wrapped to 0xF borrowed and needs another 6 taken off to read 9
+   bcd--;
+   if ((bcd & 0x000F) == 0x000F)
    {
-      setLed(true);
-      _delay_ms(blinkPeriodMsec);
-      setLed(false);
-      _delay_ms(blinkPeriodMsec);
-      iter++;
+      bcd -= 0x0006;
+      if ((bcd & 0x00F0) == 0x00F0)
+      {
+         bcd -= 0x0060;
+         if ((bcd & 0x0F00) == 0x0F00)
+         {
+            bcd -= 0x0600;
+         }
+      }
    }
-   // clear LED after blinking is done
-   setLed(false);
+   return bcd;
 }
 
 /*!
- * @brief Set or clear audio output SHDN pin based on provided bool arg.
- * 
- * @param isAudioEnabled
- *   Set SHDN pin high if True, else set SHDN pin low
- * 
- * @return None
+ * @brief Convert a four digit packed BCD value to binary
+ *
+ * @param bcd
+ *  The packed BCD value
+ *
+ * @return The same value in binary
  */
-static void setAudioIsEnabled(bool isAudioEnabled)
+static uint16_t bcdToBinary(uint16_t bcd)
 {
-   if (isAudioEnabled) 
-   {
-      PORTB.OUTSET = PIN3_bm;
-   }   
-   else 
+   return (bcd >> 12) * 1000 + ((bcd >> 8) & 0x0F) * 100 + ((bcd >> 4) & 0x0F) * 10 + (bcd & 0x0F);
+}
+
+/*!
+ * @brief Return how long the countdown ran before the wire was cut, from the time left on it
+ *
+ * @param None
+ *
+ * @return Centiseconds from the countdown starting
+ */
+static uint16_t centisToCut(void)
+{
+   uint16_t countdown;
+
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
    {
-      PORTB.OUTCLR = PIN3_bm;   
-   }      
+      countdown = countdownBcd;
+   }
+   return bcdToBinary(COUNTDOWN_START_BCD) - bcdToBinary(countdown);
 }
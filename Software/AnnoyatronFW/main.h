@@ -10,20 +10,43 @@
 
 #include "stdbool.h"
 #include "stdint.h"
+#include "Timebase.h"
 
 #ifndef MAIN_H_
 #define MAIN_H_
 
-#define F_CPU 3333333  ///< Frequency of CPU in HZ
+#define F_CPU 10000000  ///< Frequency of CPU in HZ, OSC20M divided by 2 in initClocks()
 
-#define NUM_CUT_WIRES 4  ///< Number of slots for cut wires on the device
+#define NUM_CUT_WIRES 4  ///< Number of slots for cut wires on the device, a game mode may play with fewer
 #define CUT_WIRES_bm (PIN4_bm | PIN5_bm | PIN6_bm | PIN7_bm) ///< bit masks for GPIO pins of cut wires
 
-#define BLINK_COUNT_SHORT  5 ///< Duration between toggles for short LED blinks
-#define BLINK_COUNT_LONG  11 ///< Duration between toggles for long LED blinks
+#define WIRE_SETTLE_TICKS TIMEBASE_MS_TO_TICKS(200)  ///< Ticks without a cut wire edge before freshly plugged in wires count as set up
 
-#define PIR_HIGH_COUNT_TO_COUNTDOWN 350 ///< Compare val for pirHighCount until state -> board_state_countdown
-#define PIR_LOW_COUNT_TO_SLEEP 350 ///< Compare val for pirLowCount until state -> board_state_sleep
+#define COUNTDOWN_START_BCD 0x1000  ///< Countdown start time as packed BCD centiseconds, i.e. 10.00 seconds
+#define BCD_SECONDS(bcd) ((((bcd) >> 12) * 10) + (((bcd) >> 8) & 0x0F))  ///< Whole seconds in a packed BCD centisecond count
+#define SIREN_SPEEDUP_PER_SEC 3  ///< How much faster the siren sweeps for every second off the countdown, in 1/SIREN_SPEED_NORMAL of its normal rate
+
+#define BLINK_COUNT_SHORT TIMEBASE_MS_TO_TICKS(100) ///< Duration between toggles for short LED blinks
+#define BLINK_COUNT_LONG TIMEBASE_MS_TO_TICKS(220) ///< Duration between toggles for long LED blinks
+#define BOOT_BLINKS 3  ///< LED blinks in the boot splash, which shows the game rule's hint meanwhile
+#define BOOT_BLINK_TICKS TIMEBASE_MS_TO_TICKS(500)  ///< Duration between toggles for the boot splash LED blinks
+
+#define PIR_HIGH_COUNT_TO_COUNTDOWN TIMEBASE_MS_TO_TICKS(7000) ///< Ticks the PIR must stay triggered until state -> board_state_countdown
+#define PIR_LOW_COUNT_TO_SLEEP TIMEBASE_MS_TO_TICKS(7000) ///< Ticks the PIR must stay untriggered until state -> board_state_sleep
+
+#define AUDIO_PWM_PRESCALER 1  ///< TCA0 split mode clock divider, see TCA_SPLIT_CLKSEL_DIV1_gc in audio_init()
+#define AUDIO_PWM_PERIOD 256  ///< TCA0 low counter period in clocks, LPER + 1
+#define AUDIO_CARRIER_HZ (F_CPU / (AUDIO_PWM_PRESCALER * AUDIO_PWM_PERIOD))  ///< PWM carrier frequency, the sample rate is set per clip, see Audio.h
+
+/** Event flags the ISRs post into pendingEvents for the main loop to handle */
+#define EVENT_TICK_bm       0x01  ///< The system tick came around, see Timebase.h
+#define EVENT_WIRE_bm       0x02  ///< A cut wire input changed, see cutWires
+#define EVENT_CLIP_DONE_bm  0x04  ///< A clip played with audio_mode_once finished playing, see Audio.h
+#define EVENT_PIR_bm        0x08  ///< The PIR sensor woke the board from sleep
+#define EVENT_ROLLOVER_bm   0x10  ///< The countdown time has run out
+#define EVENT_AUDIO_bm      0x20  ///< The audio ring buffer is down to AUDIO_RING_LOW_WATER and needs audio_fill(), see Audio.h
+#define EVENT_SPLASH_DONE_bm 0x40  ///< The boot splash has finished blinking, clear the hint off the display
+#define EVENT_PIR_SETTLED_bm 0x80  ///< The PIR held its level since its last edge for PIR_HIGH_COUNT_TO_COUNTDOWN or PIR_LOW_COUNT_TO_SLEEP ticks
 
 #define PC0_INTERRUPT  PORTC.INTFLAGS & PIN0_bm  ///< True if the PortC pin0 GPIO interrupt fired
 #define PC0_CLEAR_INTERRUPT_FLAG  PORTC.INTFLAGS |= PIN0_bm  ///< Clear the PortC pin0 interrupt flag bit
@@ -37,9 +60,26 @@ typedef enum board_state_enum
    board_state_countdown,
    board_state_success,
    board_state_failure,
-   board_state_done
+   board_state_done,
+   board_state_count  ///< Number of states, not a state itself
 } board_state_t;
 
+/** Game events that move the state machine along, see transitionTable in main.c */
+typedef enum game_event_enum
+{
+   game_event_none,  ///< Nothing happened
+   game_event_motion,  ///< The PIR woke the board
+   game_event_motion_held,  ///< The PIR saw motion for PIR_HIGH_COUNT_TO_COUNTDOWN ticks in a row
+   game_event_motion_gone,  ///< The PIR saw nothing for PIR_LOW_COUNT_TO_SLEEP ticks in a row
+   game_event_wires_ready,  ///< All wires are plugged in and have settled
+   game_event_partial_cut,  ///< The wires cut so far are a safe start, but the rule wants more
+   game_event_proper_cut,  ///< The wires cut so far win the game, see gamemode.h
+   game_event_wrong_cut,  ///< A wire was cut that the rule does not allow
+   game_event_rollover,  ///< The countdown ran out
+   game_event_clip_done,  ///< The one-shot success or failure clip finished
+   game_event_count  ///< Number of game events, not an event itself
+} game_event_t;
+
 /** State machine to hold the blinking pattern for different cut_wires options */
 typedef enum blink_state_enum
 {
@@ -54,9 +94,7 @@ typedef enum blink_state_enum
 	blink_state_0      = 0,
 } blink_state_t;
 
-extern volatile bool ADCResRdy;
-
-void ledUsrBlink(uint8_t count, const int blinkPeriodMsec);
+extern volatile uint8_t pendingEvents;
 
 
 #endif /* MAIN_H_ */
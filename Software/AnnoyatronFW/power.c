@@ -0,0 +1,169 @@
+/*!
+ * @file power.c
+ *
+ * Power profiling instrumentation for the POWER_PROFILE build
+ *
+ * Every state change, sleep and wakeup charges the msec since the one before to the state and the
+ * power mode the board was in. The intervals are mostly far shorter than a msec while audio plays, but
+ * each one is charged the msec boundaries that fell inside it, so the totals still come out exact.
+ * The RTC stops counting in PWR_DOWN, so there the PIT, which keeps running off the same OSCULP32K,
+ * counts the time instead at POWER_PIT_MS resolution. It wakes the board once a period to do so.
+ *
+ */
+
+#ifdef POWER_PROFILE
+
+#include "power.h"
+#include "Timebase.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <util/atomic.h>
+
+#if (POWER_PIT_MS != 1000)
+#error "POWER_PIT_MS must match the RTC_PERIOD_CYC32768_gc PIT period set in power_init()"
+#endif
+
+static void charge(void);
+
+power_stats_t powerStats;  ///< Residency counters, read back over UPDI by powerprofile.py
+
+static uint32_t lastMs;  ///< timebase_ms() when the time was last charged
+static volatile uint32_t pwrDownMs;  ///< Time counted by the PIT in PWR_DOWN and not yet charged
+static board_state_t chargedState;  ///< State the time since lastMs is charged to
+static volatile power_mode_t chargedMode;  ///< Mode the time since lastMs is charged to, the PIT ISR only counts in PWR_DOWN
+
+/*!
+ * @brief Clear the counters and start the PIT, time is charged from the next power_setState() on.
+ *  Call after timebase_init(), which picks the RTC clock the PIT runs on
+ *
+ * @param None
+ *
+ * @return None
+ */
+void power_init(void)
+{
+   uint8_t idx;
+
+   for (idx = 0; idx < board_state_count; idx++)
+   {
+      powerStats.stateMs[idx] = 0;
+   }
+   for (idx = 0; idx < power_mode_count; idx++)
+   {
+      powerStats.modeMs[idx] = 0;
+      powerStats.sleeps[idx] = 0;
+   }
+   powerStats.pirWakeups = 0;
+
+   pwrDownMs = 0;
+   chargedMode = power_mode_active;
+   chargedState = board_state_wire_setup;
+   lastMs = timebase_ms();
+
+   while (RTC.PITSTATUS & RTC_CTRLBUSY_bm);
+   RTC.PITINTCTRL = RTC_PI_bm;
+   RTC.PITCTRLA = RTC_PERIOD_CYC32768_gc | RTC_PITEN_bm;
+}
+
+/*!
+ * @brief Charge the time so far to the old state and charge from now on to 'state'
+ *
+ * @param state
+ *  The state being entered
+ *
+ * @return None
+ */
+void power_setState(board_state_t state)
+{
+   charge();
+   chargedState = state;
+}
+
+/*!
+ * @brief Charge the time awake, and from now on charge 'sleepMode'
+ *
+ * @param sleepMode
+ *  The SLEEP_MODE_* about to be entered
+ *
+ * @return None
+ */
+void power_sleep(uint8_t sleepMode)
+{
+   power_mode_t mode;
+
+   switch (sleepMode)
+   {
+      case SLEEP_MODE_PWR_DOWN:
+         mode = power_mode_pwr_down;
+         break;
+
+      case SLEEP_MODE_STANDBY:
+         mode = power_mode_standby;
+         break;
+
+      default:
+         mode = power_mode_idle;
+         break;
+   }
+
+   charge();
+   chargedMode = mode;
+   powerStats.sleeps[mode]++;
+}
+
+/*!
+ * @brief Charge the time asleep, and from now on charge being awake
+ *
+ * @param None
+ *
+ * @return None
+ */
+void power_wake(void)
+{
+   charge();
+   chargedMode = power_mode_active;
+}
+
+/*!
+ * @brief Add the time since lastMs to chargedState and chargedMode
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void charge(void)
+{
+   uint32_t now = timebase_ms();
+   uint32_t elapsed = now - lastMs;
+
+   ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+   {
+      elapsed += pwrDownMs;
+      pwrDownMs = 0;
+   }
+   lastMs = now;
+   powerStats.stateMs[chargedState] += elapsed;
+   powerStats.modeMs[chargedMode] += elapsed;
+}
+
+/*!
+ * @ingroup ISRs
+ * @brief PIT interrupt every POWER_PIT_MS, counts the time spent in PWR_DOWN while the RTC is stopped
+ *
+ * @param RTC_PIT_vect
+ *  Unused parameter required by interface
+ *
+ * @return None
+ */
+ISR(RTC_PIT_vect)
+{
+   RTC.PITINTFLAGS = RTC_PI_bm;
+   if (chargedMode == power_mode_pwr_down)
+   {
+      pwrDownMs += POWER_PIT_MS;
+   }
+}
+
+#endif /* POWER_PROFILE */
@@ -0,0 +1,69 @@
+/*!
+ * @file power.h
+ *
+ * Created: 10/16/2026
+ *
+ * Power profiling instrumentation for the POWER_PROFILE build. Time spent in each board_state_t and
+ * in each sleep mode is added up in powerStats, which Scripts/Linux/powerprofile.py reads back over
+ * UPDI and turns into an estimated battery draw. Without POWER_PROFILE defined the macros compile to nothing.
+ *
+ */
+
+#include "stdint.h"
+#include "main.h"
+
+#ifndef POWER_H_
+#define POWER_H_
+
+#define POWER_PIT_MS 1000  ///< Length of one PIT period in msec, the resolution of the time spent in PWR_DOWN
+
+/** What the CPU is doing, awake or in one of the sleep modes sleepUntilEvent() uses */
+typedef enum power_mode_enum
+{
+   power_mode_active,  ///< Awake and running code
+   power_mode_idle,  ///< SLEEP_MODE_IDLE
+   power_mode_standby,  ///< SLEEP_MODE_STANDBY
+   power_mode_pwr_down,  ///< SLEEP_MODE_PWR_DOWN
+   power_mode_count  ///< Number of modes, not a mode itself
+} power_mode_t;
+
+/** Residency counters, all msec since power_init() unless said otherwise */
+typedef struct power_stats_struct
+{
+   uint32_t stateMs[board_state_count];  ///< Time spent in each board_state_t, awake and asleep
+   uint32_t modeMs[power_mode_count];  ///< Time spent in each power_mode_t, over all states
+   uint32_t sleeps[power_mode_count];  ///< Times each sleep mode was entered, power_mode_active stays zero
+   uint32_t pirWakeups;  ///< Times ISR(PORTC_PORT_vect) saw the PIR and woke the main loop
+} power_stats_t;
+
+#ifdef POWER_PROFILE
+
+/** Charge the time since the last call to the old state and move on to 'state' */
+#define POWER_SET_STATE(state) power_setState(state)
+
+/** Charge the time awake and count a sleep in 'sleepMode', call with interrupts off right before sleeping */
+#define POWER_SLEEP(sleepMode) power_sleep(sleepMode)
+
+/** Charge the time asleep, call right after waking */
+#define POWER_WAKE() power_wake()
+
+/** Count a PIR wakeup, from ISR(PORTC_PORT_vect) */
+#define POWER_PIR_WAKEUP() (powerStats.pirWakeups++)
+
+extern power_stats_t powerStats;
+
+void power_init(void);
+void power_setState(board_state_t state);
+void power_sleep(uint8_t sleepMode);
+void power_wake(void);
+
+#else
+
+#define POWER_SET_STATE(state)
+#define POWER_SLEEP(sleepMode)
+#define POWER_WAKE()
+#define POWER_PIR_WAKEUP()
+
+#endif /* POWER_PROFILE */
+
+#endif /* POWER_H_ */
@@ -3,67 +3,139 @@
  *
  * Copyright (c) 2017, ?ukasz Marcin Podkalicki <lpodkalicki@gmail.com>
  *
- * Lightweight library of 16 bit random number generator based on LFSR.
+ * Lightweight random number generator.
+ *
+ * Used in this project to deal the game rule. The generator is Marsaglia's 32 bit xorshift, three
+ * shifts and xors per draw. One ADC conversion of a floating pin used to be the whole seed, and its
+ * few bits of noise dealt visibly lopsided games across power cycles. Now every seed source is xored
+ * into the state with a generator step in between, which spreads each new bit over all 32 without
+ * losing any gathered so far:
+ *  - the ADC noise of RANDOM_ENTROPY_SAMPLES conversions of the floating pin
+ *  - where TCB0, counting the OSC20M CPU clock, stands at each edge of the RTC on the separate OSCULP32K,
+ *    whose jitter against each other shows in the low bits
+ *  - a seed the boot before left in EEPROM, so the games move on from boot to boot even if the pin and
+ *    the clocks happen to read the same twice
  *
- * Used in this project to generate the wire-to-cut after being seeded by
- * an ADC sample on a floating pin
  */
 
+#include <avr/io.h>
 #include <avr/eeprom.h>
 #include "main.h"
 #include "random.h"
 
-static uint16_t random_number = 0;  ///< Returned random number
+static uint32_t xorshift32(uint32_t x);
+
+static uint32_t state = RANDOM_FALLBACK_STATE;  ///< Generator state, never zero
+
+/*!
+ * @brief Step the xorshift generator
+ *
+ * @param x
+ *  The current state, not zero
+ *
+ * @return The next state
+ */
+static uint32_t xorshift32(uint32_t x)
+{
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return x;
+}
 
 /*!
- * @brief return next LFSR value
+ * @brief Gather the ADC noise and clock jitter to seed the generator with.
+ *  Call after timebase_init(), which starts the RTC, and after initADC(). Leaves the ADC off
  *
- * @param n
- *  the current LFSR-returned value
- * 
- * @return next uint16_t LFSR value
+ * @return The gathered entropy, mixed into 32 bits
  */
-static uint16_t lfsr16_next(uint16_t n)
+uint32_t random_gatherEntropy(void)
 {
-	return (n >> 0x01U) ^ (-(n & 0x01U) & 0xB400U);
+	uint32_t pool = 0;
+	uint16_t rtcStart;
+	uint16_t jitter;
+	uint8_t idx;
+	bool isTcbOurs = !(TCB0.CTRLA & TCB_ENABLE_bm);
+
+	// the BENCHMARK build already has TCB0 free-running on CLK_PER, anything else gets it started here
+	if (isTcbOurs)
+	{
+		TCB0.CTRLB = TCB_CNTMODE_INT_gc;
+		TCB0.INTCTRL = 0;
+		TCB0.CCMP = 0xFFFF;
+		TCB0.CTRLA = TCB_CLKSEL_CLKDIV1_gc | TCB_ENABLE_bm;
+	}
+
+	for (idx = 0; idx < RANDOM_ENTROPY_SAMPLES; idx++)
+	{
+		ADC0.COMMAND = ADC_STCONV_bm;
+
+		// the conversion and the wait for the next RTC edge overlap, the edge comes later
+		rtcStart = RTC.CNT;
+		while (RTC.CNT == rtcStart);
+		jitter = TCB0.CNT;
+
+		while (!(ADC0.INTFLAGS & ADC_RESRDY_bm));
+		pool = xorshift32(pool ^ (((uint32_t) jitter << 16) | ADC0.RES));
+	}
+
+	ADC0.CTRLA = 0;
+	if (isTcbOurs)
+	{
+		TCB0.CTRLA = 0;
+	}
+	return pool;
 }
 
 /*!
- * @brief Initialize the random generator.
- * 
- * @param seed
- *  A uint16_t random seed to start the LFSR values
+ * @brief Initialize the random generator, and leave a new seed in EEPROM for the next boot.
+ *
+ * @param entropy
+ *  Entropy from random_gatherEntropy()
  */
-void random_init(uint16_t seed)
+void random_init(uint32_t entropy)
 {
-#ifdef USE_RANDOM_SEED
-	random_number = lfsr16_next(eeprom_read_word((uint16_t *)RANDOM_SEED_ADDRESS) ^ seed);
-        eeprom_write_word((uint16_t *)0, random_number);
-#else
-	random_number = seed;
-#endif	/* !USE_RANDOM_SEED */
+	state = xorshift32(entropy ^ eeprom_read_dword((const uint32_t *) RANDOM_SEED_ADDRESS));
+	if (!state)
+	{
+		state = RANDOM_FALLBACK_STATE;
+	}
+
+	// a step on, so this boot's state cannot be read back out of EEPROM
+	state = xorshift32(state);
+	eeprom_update_dword((uint32_t *) RANDOM_SEED_ADDRESS, xorshift32(state ^ RANDOM_FALLBACK_STATE));
 }
 
 /*!
  * @brief Return a random number.
  *
- * @return random uint16_t
+ * @return random uint16_t, the top half of the state as xorshift's low bits are its weakest
  */
 uint16_t random(void)
 {
-	return (random_number = lfsr16_next(random_number));
+	state = xorshift32(state);
+	return (uint16_t) (state >> 16);
 }
 
 /*!
- * @brief Use the ATTiny1606 ADC to get a random seed to use in random_init.
+ * @brief Return a random number below 'bound', every value equally likely.
+ *  Plain random() % bound would favour the low values whenever bound does not divide 65536, so draws
+ *  from the short range at the bottom that cannot be spread evenly are thrown away and drawn again
  *
- * @return random seed as uint16_t
+ * @param bound
+ *  One more than the largest value wanted, not zero
+ *
+ * @return random uint16_t from 0 to bound - 1
  */
-uint16_t adcGetSeed(void)
+uint16_t random_below(uint16_t bound)
 {
-   // Start ADC capture, and then wait for result to return
-   ADC0.COMMAND = ADC_STARTEI_bm;
-   while (!ADCResRdy);
-   
-   return ADC0.RES;   
+	// 65536 % bound, the number of draws to throw away
+	uint16_t threshold = (uint16_t) (0U - bound) % bound;
+	uint16_t draw;
+
+	do
+	{
+		draw = random();
+	} while (draw < threshold);
+	return draw % bound;
 }
@@ -3,22 +3,24 @@
  *
  * Copyright (c) 2017, ?ukasz Marcin Podkalicki <lpodkalicki@gmail.com>
  *
- * Lightweight library of 16 bit random number generator based on LFSR.
+ * Lightweight random number generator, a 32 bit xorshift seeded from ADC noise, clock jitter and a
+ * seed carried over in EEPROM from the boot before.
  *
- * Holds definitions and prototypes for the random generator code
+ * Holds definitions and prototypes for the random generator code. The generator and the bounded
+ * draw must match Scripts/Linux/randomstats.py
  */
 
 #ifndef _RANDOM_H_
 #define	_RANDOM_H_
 
+#define	RANDOM_SEED_ADDRESS	0x00  ///< EEPROM address of the seed carried from boot to boot, page 0 is kept for it
+#define RANDOM_ENTROPY_SAMPLES 32  ///< ADC conversions, each timed against an RTC edge, mixed in at boot. About 30 usec each
+#define RANDOM_FALLBACK_STATE 0x2545F491UL  ///< Generator state used if the mixing happens to land on zero, which xorshift never leaves
 
-#ifdef	USE_RANDOM_SEED
-#define	RANDOM_SEED_ADDRESS	0x00  ///< Setup a pointer to the location of a random seed if USE_RANDOM_SEED is defined
-#endif	/* !USE_RANDOM_SEED */
-
-void random_init(uint16_t seed);
+uint32_t random_gatherEntropy(void);
+void random_init(uint32_t entropy);
 uint16_t random(void);
-uint16_t adcGetSeed(void);
+uint16_t random_below(uint16_t bound);
 
 
 #endif	/* !_RANDOM_H_ */
@@ -0,0 +1,85 @@
+/*!
+ * @file siren.c
+ *
+ * Countdown siren oscillator
+ *
+ * A phase accumulator steps through a short waveform table at a pitch that rises from SIREN_LOW_HZ
+ * to SIREN_HIGH_HZ and then drops back, over and over. This replaces the looping siren clip and its
+ * flash with a few constants, and lets the sweep speed up as the countdown runs out. The waveform is a
+ * sine with a third of its third harmonic mixed in, which is closer to a square wave and carries better
+ * through the small speaker.
+ *
+ */
+
+#include "siren.h"
+
+#define LOW_STEP_Q8 (SIREN_HZ_TO_STEP(SIREN_LOW_HZ) * 256)  ///< pitchQ8 at the bottom of the sweep
+#define HIGH_STEP_Q8 (SIREN_HZ_TO_STEP(SIREN_HIGH_HZ) * 256)  ///< pitchQ8 at the top of the sweep
+#define SWEEP_SAMPLES (SIREN_SWEEP_MS * SIREN_SAMPLE_RATE_HZ / 1000)  ///< Samples in one sweep at SIREN_SPEED_NORMAL
+#define SWEEP_NORMAL_Q8 ((HIGH_STEP_Q8 - LOW_STEP_Q8) / SWEEP_SAMPLES)  ///< sweepQ8 at SIREN_SPEED_NORMAL
+
+#if (SIREN_HIGH_HZ * 3 * 2 > SIREN_SAMPLE_RATE_HZ)
+#error "The siren's third harmonic would alias, lower SIREN_HIGH_HZ"
+#endif
+
+#if (SWEEP_NORMAL_Q8 * 255 / SIREN_SPEED_NORMAL > 0xFFFF)
+#error "sweepQ8 is 16 bits, lengthen SIREN_SWEEP_MS"
+#endif
+
+/** One cycle of the siren waveform, unsigned 8 bit with 128 as silence */
+static const uint8_t sirenWave[1 << SIREN_WAVE_BITS] = {
+   128, 166, 197, 216, 222, 218, 208, 198, 195, 198, 208, 218, 222, 216, 197, 166,
+   128, 90, 59, 40, 34, 38, 48, 58, 61, 58, 48, 38, 34, 40, 59, 90
+};
+
+/*!
+ * @brief Start a siren at the bottom of its sweep, at SIREN_SPEED_NORMAL
+ *
+ * @param state
+ *  The oscillator state to reset
+ *
+ * @return None
+ */
+void siren_reset(siren_state_t *state)
+{
+   state->phase = 0;
+   state->pitchQ8 = LOW_STEP_Q8;
+   siren_setSpeed(state, SIREN_SPEED_NORMAL);
+}
+
+/*!
+ * @brief Change how fast the siren sweeps, without disturbing the pitch it is at
+ *
+ * @param state
+ *  The oscillator state to change
+ *
+ * @param speed
+ *  Sweep rate in 1/SIREN_SPEED_NORMAL of the normal rate, e.g. 2 * SIREN_SPEED_NORMAL sweeps twice as often
+ *
+ * @return None
+ */
+void siren_setSpeed(siren_state_t *state, uint8_t speed)
+{
+   state->sweepQ8 = (uint16_t) ((SWEEP_NORMAL_Q8 * speed) / SIREN_SPEED_NORMAL);
+}
+
+/*!
+ * @brief Produce the next siren sample and move the pitch along the sweep
+ *
+ * @param state
+ *  The running oscillator state
+ *
+ * @return Unsigned 8 bit sample ready to be loaded into the PWM compare register
+ */
+uint8_t siren_next(siren_state_t *state)
+{
+   uint8_t sample = sirenWave[state->phase >> (16 - SIREN_WAVE_BITS)];
+
+   state->phase += (uint16_t) (state->pitchQ8 >> 8);
+   state->pitchQ8 += state->sweepQ8;
+   if (state->pitchQ8 >= HIGH_STEP_Q8)
+   {
+      state->pitchQ8 = LOW_STEP_Q8;
+   }
+   return sample;
+}
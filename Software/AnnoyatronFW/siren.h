@@ -0,0 +1,40 @@
+/*!
+ * @file siren.h
+ *
+ * Created: 10/16/2026
+ *
+ * Definitions and prototypes for the countdown siren, synthesized one sample at a time instead of
+ * being stored as a clip in audioArrays.h
+ *
+ */
+
+#include "stdint.h"
+#include "main.h"
+
+#ifndef SIREN_H_
+#define SIREN_H_
+
+#define SIREN_SAMPLE_RATE_HZ 8000  ///< Rate the siren is synthesized and played at
+#define SIREN_LOW_HZ 500  ///< Pitch at the bottom of each sweep
+#define SIREN_HIGH_HZ 1000  ///< Pitch at the top of each sweep, its third harmonic must stay under half of SIREN_SAMPLE_RATE_HZ
+#define SIREN_SWEEP_MS 300  ///< Duration of one sweep from low to high at SIREN_SPEED_NORMAL
+#define SIREN_SPEED_NORMAL 16  ///< siren_setSpeed() value that sweeps in SIREN_SWEEP_MS, larger is faster
+#define SIREN_WAVE_BITS 5  ///< log2 of the number of entries in the waveform table
+
+/** Phase advance per sample for a pitch in HZ, where a full waveform cycle is 65536 */
+#define SIREN_HZ_TO_STEP(hz) ((hz) * 65536UL / SIREN_SAMPLE_RATE_HZ)
+
+/** Running state of the siren oscillator */
+typedef struct siren_state_struct
+{
+   uint16_t phase;  ///< Position in the waveform, a full cycle is 65536
+   uint32_t pitchQ8;  ///< Phase advance per sample with 8 fractional bits, sets the pitch
+   uint16_t sweepQ8;  ///< Pitch rise per sample with 8 fractional bits, sets how fast the siren sweeps
+} siren_state_t;
+
+void siren_reset(siren_state_t *state);
+void siren_setSpeed(siren_state_t *state, uint8_t speed);
+uint8_t siren_next(siren_state_t *state);
+
+
+#endif /* SIREN_H_ */
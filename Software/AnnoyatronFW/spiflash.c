@@ -0,0 +1,183 @@
+/*!
+ * @file spiflash.c
+ *
+ * External SPI NOR flash audio source for the AUDIO_SPI_FLASH build
+ *
+ * Clips are streamed rather than read in blocks: spiflash_stream() starts a READ at the clip's
+ * address and leaves chip select low, after which every spiflash_next() clocks out the next byte.
+ * audio_fill() pulls the bytes in as it decodes, so the ring buffer is the only read-ahead needed.
+ * Between clips the part is kept in deep power-down. Only the main loop touches SPI0.
+ *
+ */
+
+#ifdef AUDIO_SPI_FLASH
+
+#include "main.h"
+#include "spiflash.h"
+
+#include <avr/io.h>
+#include <util/delay.h>
+
+static uint8_t transfer(uint8_t data);
+static void wake(void);
+static void select(uint8_t cmd);
+static void deselect(void);
+
+static bool isAwake;  ///< The part is out of deep power-down
+
+/*!
+ * @brief Set up SPI0 as master at F_CPU / 2 and put the flash into deep power-down.
+ *  Call after random_gatherEntropy(), see spiflash.h
+ *
+ * @param None
+ *
+ * @return None
+ */
+void spiflash_init(void)
+{
+   PORTB.OUTSET = SPIFLASH_CS_bm;
+   PORTB.DIRSET = SPIFLASH_CS_bm;
+   PORTA.DIRSET = SPIFLASH_SPI_PINS_bm;
+   PORTA.DIRCLR = PIN2_bm;
+
+   // chip select is a plain GPIO, so keep the hardware SS pin from knocking SPI0 out of master mode
+   SPI0.CTRLB = SPI_SSD_bm | SPI_MODE_0_gc;
+   SPI0.CTRLA = SPI_MASTER_bm | SPI_CLK2X_bm | SPI_PRESC_DIV4_gc | SPI_ENABLE_bm;
+
+   isAwake = true;
+   spiflash_end();
+}
+
+/*!
+ * @brief Read 'len' bytes from 'addr' on, leaving the part awake for a spiflash_stream() to follow
+ *
+ * @param addr
+ *  Flash address of the first byte
+ *
+ * @param buf
+ *  Where to put the bytes
+ *
+ * @param len
+ *  How many bytes to read
+ *
+ * @return None
+ */
+void spiflash_read(uint32_t addr, void *buf, uint8_t len)
+{
+   uint8_t *out = buf;
+
+   spiflash_stream(addr);
+   while (len--)
+   {
+      *out++ = transfer(0);
+   }
+   deselect();
+}
+
+/*!
+ * @brief Start reading from 'addr' on, ending any read already in progress
+ *
+ * @param addr
+ *  Flash address of the first byte spiflash_next() will return
+ *
+ * @return None
+ */
+void spiflash_stream(uint32_t addr)
+{
+   wake();
+   select(SPIFLASH_CMD_READ);
+   transfer((uint8_t) (addr >> 16));
+   transfer((uint8_t) (addr >> 8));
+   transfer((uint8_t) addr);
+}
+
+/*!
+ * @brief Return the next byte of the read started by spiflash_stream()
+ *
+ * @param None
+ *
+ * @return The byte
+ */
+uint8_t spiflash_next(void)
+{
+   return transfer(0);
+}
+
+/*!
+ * @brief End any read in progress and put the part into deep power-down until the next spiflash_stream()
+ *
+ * @param None
+ *
+ * @return None
+ */
+void spiflash_end(void)
+{
+   if (isAwake)
+   {
+      select(SPIFLASH_CMD_POWER_DOWN);
+      deselect();
+      isAwake = false;
+   }
+}
+
+/*!
+ * @brief Clock one byte out to the flash and the byte it sent back in
+ *
+ * @param data
+ *  Byte to send
+ *
+ * @return Byte received
+ */
+static uint8_t transfer(uint8_t data)
+{
+   SPI0.DATA = data;
+   while (!(SPI0.INTFLAGS & SPI_IF_bm));
+   return SPI0.DATA;
+}
+
+/*!
+ * @brief Bring the part out of deep power-down if it is in it
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void wake(void)
+{
+   if (!isAwake)
+   {
+      select(SPIFLASH_CMD_RELEASE);
+      deselect();
+      _delay_us(SPIFLASH_RELEASE_US);
+      isAwake = true;
+   }
+}
+
+/*!
+ * @brief Pull chip select low, ending any read in progress first, and send a command
+ *
+ * @param cmd
+ *  One of the SPIFLASH_CMD_* commands
+ *
+ * @return None
+ */
+static void select(uint8_t cmd)
+{
+   deselect();
+   PORTB.OUTCLR = SPIFLASH_CS_bm;
+   transfer(cmd);
+}
+
+/*!
+ * @brief Release chip select, which ends the command in progress
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void deselect(void)
+{
+   PORTB.OUTSET = SPIFLASH_CS_bm;
+}
+
+#endif /* AUDIO_SPI_FLASH */
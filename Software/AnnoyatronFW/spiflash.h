@@ -0,0 +1,59 @@
+/*!
+ * @file spiflash.h
+ *
+ * Created: 10/16/2026
+ *
+ * Definitions and prototypes for streaming audio clips out of an external SPI NOR flash on SPI0,
+ * built in only with AUDIO_SPI_FLASH defined. The image layout must match audio/flashImage.py
+ *
+ */
+
+#include "stdint.h"
+
+#ifndef SPIFLASH_H_
+#define SPIFLASH_H_
+
+/*
+ * SPI0 runs on its default pins, PA1 (MOSI), PA2 (MISO) and PA3 (SCK), with chip select on PB5.
+ * PA1 is also the floating ADC input that seeds the wire choice, so spiflash_init() must only be
+ * called once random_gatherEntropy() is done with it
+ */
+#define SPIFLASH_CS_bm PIN5_bm  ///< Chip select pin on PORTB, active low
+#define SPIFLASH_SPI_PINS_bm (PIN1_bm | PIN3_bm)  ///< MOSI and SCK on PORTA, driven by SPI0
+
+#define SPIFLASH_CMD_READ 0x03  ///< Read data from a 24 bit address on, for as long as chip select stays low
+#define SPIFLASH_CMD_POWER_DOWN 0xB9  ///< Enter deep power-down
+#define SPIFLASH_CMD_RELEASE 0xAB  ///< Leave deep power-down
+#define SPIFLASH_RELEASE_US 30  ///< Longest time common NOR parts take to leave deep power-down
+#define SPIFLASH_BYTE_CYCLES 24  ///< Worst-case cycles for spiflash_next(), 16 to clock the byte at F_CPU / 2 plus the call and polling
+
+#define SPIFLASH_IMAGE_MAGIC 0x31594E41UL  ///< "ANY1" read as a little endian uint32_t, at the start of a valid image
+#define SPIFLASH_DIR_ADDR sizeof(spiflash_header_t)  ///< Flash address of the clip directory, right after the header
+
+/** Header at flash address 0 */
+typedef struct spiflash_header_struct
+{
+   uint32_t magic;  ///< SPIFLASH_IMAGE_MAGIC
+   uint8_t clipCount;  ///< Entries in the clip directory
+   uint8_t reserved[3];  ///< Written as zero
+} spiflash_header_t;
+
+/** One clip directory entry, indexed by audio_clip_t. All fields are little endian like the AVR */
+typedef struct spiflash_clip_struct
+{
+   uint32_t offset;  ///< Flash address of the clip's first byte
+   uint32_t numSamples;  ///< Samples in the clip
+   uint32_t loopStart;  ///< Sample to go back to at the end in audio_mode_loop
+   uint16_t sampleRate;  ///< Samples per second
+   uint8_t format;  ///< AUDIO_FORMAT_PCM8 or AUDIO_FORMAT_ADPCM4, anything else marks an empty slot
+   uint8_t reserved;  ///< Written as zero
+} spiflash_clip_t;
+
+void spiflash_init(void);
+void spiflash_read(uint32_t addr, void *buf, uint8_t len);
+void spiflash_stream(uint32_t addr);
+uint8_t spiflash_next(void);
+void spiflash_end(void);
+
+
+#endif /* SPIFLASH_H_ */
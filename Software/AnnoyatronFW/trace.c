@@ -0,0 +1,160 @@
+/*!
+ * @file trace.c
+ *
+ * Binary trace on USART0
+ *
+ * trace_emit() copies a record into the ring with interrupts off, a few dozen cycles, and the USART0
+ * data register empty interrupt sends it a byte at a time. Once the ring is empty the transmit complete
+ * interrupt waits for the last byte to leave the shift register, so trace_isBusy() stays true until the
+ * line is idle. USART0 stops in STANDBY and PWR_DOWN, so sleepUntilEvent() idles until then.
+ *
+ * A full ring drops the new record rather than waiting, since records come from the ISRs as well, and
+ * the count of dropped records is sent as soon as the ring drains.
+ *
+ */
+
+#include "trace.h"
+#include "Timebase.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/** USART0.BAUD for TRACE_BAUD in CLK2X mode, in 1/64ths of a CLK_PER cycle per bit */
+#define TRACE_BAUD_REG ((8 * F_CPU + TRACE_BAUD / 2) / TRACE_BAUD)
+
+#if (TRACE_BAUD_REG < 64)
+#error "TRACE_BAUD is too fast for F_CPU, USART0.BAUD must be at least 64"
+#endif
+#if (TRACE_RING_LEN & (TRACE_RING_LEN - 1)) || (TRACE_RING_LEN > 256)
+#error "TRACE_RING_LEN must be a power of two no larger than 256"
+#endif
+
+#define RING_MASK (TRACE_RING_LEN - 1)  ///< Wraps a ring index
+
+static volatile uint8_t ring[TRACE_RING_LEN];  ///< Bytes waiting to be sent
+static volatile uint8_t ringHead;  ///< Index the next record goes in at
+static volatile uint8_t ringTail;  ///< Index of the next byte to send
+static volatile uint8_t dropped;  ///< Records lost to a full ring since the last trace_type_dropped
+
+/*!
+ * @brief Set up USART0 to send the trace, and queue a trace_type_reset record.
+ *  Call after timebase_init(), which stamps the records
+ *
+ * @param None
+ *
+ * @return None
+ */
+void trace_init(void)
+{
+   uint8_t resetFlags = RSTCTRL.RSTFR;
+
+   ringHead = 0;
+   ringTail = 0;
+   dropped = 0;
+
+   // drive the idle level before the USART takes the pin over
+   PORTB.OUTSET = TRACE_TX_bm;
+   PORTB.DIRSET = TRACE_TX_bm;
+   USART0.BAUD = (uint16_t) TRACE_BAUD_REG;
+   USART0.CTRLC = USART_CMODE_ASYNCHRONOUS_gc | USART_PMODE_DISABLED_gc | USART_SBMODE_1BIT_gc | USART_CHSIZE_8BIT_gc;
+   USART0.CTRLB = USART_TXEN_bm | USART_RXMODE_CLK2X_gc;
+
+   // the flags stick until cleared, so clear them to tell the next reset apart
+   RSTCTRL.RSTFR = resetFlags;
+   trace_emit(trace_type_reset, resetFlags);
+}
+
+/*!
+ * @brief Queue a trace record, or count it as dropped if the ring is full. Safe to call from ISRs
+ *
+ * @param type
+ *  What the record reports
+ *
+ * @param arg
+ *  The argument byte, see trace_type_t
+ *
+ * @return None
+ */
+void trace_emit(trace_type_t type, uint8_t arg)
+{
+   uint8_t sreg = SREG;
+   uint8_t head;
+   uint16_t stamp;
+
+   cli();
+   head = ringHead;
+   if (((uint8_t) (ringTail - head - 1) & RING_MASK) < TRACE_RECORD_LEN)
+   {
+      if (dropped != 0xFF) dropped++;
+   }
+   else
+   {
+      stamp = timebase_msLow();
+      ring[head] = TRACE_SYNC;
+      ring[(head + 1) & RING_MASK] = type;
+      ring[(head + 2) & RING_MASK] = arg;
+      ring[(head + 3) & RING_MASK] = (uint8_t) stamp;
+      ring[(head + 4) & RING_MASK] = (uint8_t) (stamp >> 8);
+      ringHead = (head + TRACE_RECORD_LEN) & RING_MASK;
+      // nothing else in CTRLA is used, and a pending TXCIE is taken over by DREIE until the ring drains again
+      USART0.CTRLA = USART_DREIE_bm;
+   }
+   SREG = sreg;
+}
+
+/*!
+ * @brief Return whether trace bytes are still queued or on their way out
+ *
+ * @param None
+ *
+ * @return True until the last queued byte has left the TXD pin, else False
+ */
+bool trace_isBusy(void)
+{
+   return 0 != (USART0.CTRLA & (USART_DREIE_bm | USART_TXCIE_bm));
+}
+
+/*!
+ * @ingroup ISRs
+ * @brief USART0 data register empty interrupt, sends the next queued byte. Once the ring is empty it
+ *  sends the dropped count if records were lost, else hands over to the transmit complete interrupt
+ *
+ * @param USART0_DRE_vect
+ *  Unused parameter required by interface
+ *
+ * @return None
+ */
+ISR(USART0_DRE_vect)
+{
+   uint8_t tail = ringTail;
+
+   if (tail == ringHead)
+   {
+      if (!dropped)
+      {
+         USART0.CTRLA = USART_TXCIE_bm;
+         return;
+      }
+      trace_emit(trace_type_dropped, dropped);
+      dropped = 0;
+   }
+
+   // TXCIF must only be set once the byte after this one has gone too
+   USART0.STATUS = USART_TXCIF_bm;
+   USART0.TXDATAL = ring[tail];
+   ringTail = (tail + 1) & RING_MASK;
+}
+
+/*!
+ * @ingroup ISRs
+ * @brief USART0 transmit complete interrupt, the last queued byte has left so the trace is idle
+ *
+ * @param USART0_TXC_vect
+ *  Unused parameter required by interface
+ *
+ * @return None
+ */
+ISR(USART0_TXC_vect)
+{
+   USART0.CTRLA = 0;
+}
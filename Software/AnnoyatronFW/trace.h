@@ -0,0 +1,42 @@
+/*!
+ * @file trace.h
+ *
+ * Created: 10/16/2026
+ *
+ * Definitions and prototypes for the binary trace sent out on USART0. Every trace_emit() queues one
+ * TRACE_RECORD_LEN byte record in a ring that the USART0 interrupts drain in the background, so it is
+ * cheap enough to stay in release builds. Scripts/Linux/tracedecode.py turns a capture into a timeline,
+ * the record layout and trace_type_t must match it
+ *
+ */
+
+#include "stdint.h"
+#include "main.h"
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#define TRACE_BAUD 1000000UL  ///< Trace baud rate, CLK2X at F_CPU gets it exactly and an FT232R can receive it
+#define TRACE_TX_bm PIN2_bm  ///< USART0 TXD on PORTB, the default pin position
+#define TRACE_RING_LEN 64  ///< Bytes queued for sending, must be a power of two no larger than 256
+#define TRACE_RECORD_LEN 5  ///< Bytes per record: TRACE_SYNC, trace_type_t, argument, msec stamp low then high byte
+#define TRACE_SYNC 0xA5  ///< First byte of every record, for the decoder to find the records in the stream
+
+/** What a trace record reports, and what its argument byte holds */
+typedef enum trace_type_enum
+{
+   trace_type_reset,  ///< The board came out of reset, argument is RSTCTRL.RSTFR
+   trace_type_state,  ///< The state machine entered a state, argument is the old board_state_t in the high nibble and the new one in the low
+   trace_type_pir,  ///< The PIR output changed, argument is its new level
+   trace_type_wire,  ///< A cut wire input changed, argument is cutWires
+   trace_type_i2c_error,  ///< An I2C transaction failed, argument is its I2C status code
+   trace_type_dropped,  ///< The ring was full, argument is how many records were lost, saturating at 0xFF
+   trace_type_count  ///< Number of record types, not a type itself
+} trace_type_t;
+
+void trace_init(void);
+void trace_emit(trace_type_t type, uint8_t arg);
+bool trace_isBusy(void);
+
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,270 @@
+"""Benchmark report for the annoyatron firmware
+
+Reads the cycle statistics that a BENCHMARK build of the firmware keeps in SRAM (see bench.h) back
+over UPDI, and prints min/mean/max cycles for every instrumented ISR and for a main loop pass in
+each board state, along with how much of the CPU the audio and tick interrupts leave free and how
+long the board took from reset to being armed.
+
+Flash a benchmark build with `make BENCHMARK=1 flash`, play a game through on the board, then run
+`make bench`. Save a run with --json and pass it back in with --baseline to flag regressions.
+"""
+import argparse  # Standard Python Library to parse command line arguments
+import json  # Standard Python Library to save and compare benchmark runs
+import os  # Standard Python Library to locate files relative to this script
+import re  # Standard Python Library to read settings out of the firmware sources
+import struct  # Standard Python Library to unpack the statistics read from SRAM
+import subprocess  # Standard Python Library to find the statistics in the firmware .elf
+import sys  # Standard Python Library to set the exit status
+
+
+def readHeader(fileName):
+    """Return the text of a firmware header
+
+    Args:
+        fileName (string): header file name in the firmware directory
+
+    Returns:
+        string: the contents of the file
+    """
+    with open(os.path.join(FW_DIR, fileName), "r") as f:
+        return f.read()
+
+
+def readDefines(text, names):
+    """Read plain integer #defines out of a firmware header
+
+    Args:
+        text (string): contents of the header
+        names (list): names of the macros to read
+
+    Returns:
+        dict: the value of each macro by name
+    """
+    values = {}
+    for name in names:
+        match = re.search(r"#define\s+" + name + r"\s+(\d+)", text)
+        if match is None:
+            raise ValueError("could not find " + name)
+        values[name] = int(match.group(1))
+    return values
+
+
+def readEnum(text, typeName):
+    """List the members of a C enum in declaration order
+
+    Args:
+        text (string): contents of the header declaring it
+        typeName (string): the typedef name of the enum, e.g. board_state_t
+
+    Returns:
+        list: member names, with any explicit '= value' dropped
+    """
+    match = re.search(r"typedef\s+enum\s+\w+\s*\{(.*?)\}\s*" + typeName + r"\s*;", text, re.S)
+    if match is None:
+        raise ValueError("could not find enum " + typeName)
+    body = re.sub(r"//.*", "", re.sub(r"/\*.*?\*/", "", match.group(1), flags=re.S))
+    return [member.split("=")[0].strip() for member in body.split(",") if member.strip()]
+
+
+def regionNames():
+    """Name every bench_stat_t in benchStats[], in the order of bench_id_t
+
+    Returns:
+        list: one readable name per region
+    """
+    benchIds = readEnum(readHeader("bench.h"), "bench_id_t")
+    states = readEnum(readHeader("main.h"), "board_state_t")
+    names = [benchId[len("bench_id_"):] for benchId in benchIds[:benchIds.index("bench_id_loop_first")]]
+    names += ["loop " + state[len("board_state_"):] for state in states if state != "board_state_count"]
+    return names
+
+
+def statsLocation(elfFileName, symbol="benchStats", buildOption="BENCHMARK=1"):
+    """Find where a statistics variable lives in SRAM
+
+    Args:
+        elfFileName (string): the instrumented build of the firmware
+        symbol (string): name of the variable, benchStats by default
+        buildOption (string): make option that builds it in, for the error message
+
+    Returns:
+        tuple: (offset from the start of SRAM, size in bytes)
+    """
+    symbols = subprocess.run(["avr-nm", "-S", elfFileName], capture_output=True, text=True, check=True).stdout
+    for line in symbols.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[3] == symbol:
+            # avr-gcc puts the data space at 0x800000 in the .elf
+            return (int(fields[0], 16) & 0xFFFF) - SRAM_START, int(fields[1], 16)
+    raise ValueError(symbol + " not found in " + elfFileName + ", build it with make " + buildOption)
+
+
+def readStats(port, offset, size, memory="internal_sram"):
+    """Read the raw statistics out of the running board's SRAM over UPDI
+
+    Args:
+        port (string): serial port of the UPDI adapter
+        offset (int): offset of benchStats[] from the start of SRAM
+        size (int): size of benchStats[] in bytes
+        memory (string): pymcuprog memory to read from instead of SRAM, e.g. "eeprom"
+
+    Returns:
+        bytes: the contents of benchStats[]
+    """
+    from pymcuprog.backend import Backend, SessionConfig
+    from pymcuprog.toolconnection import ToolSerialConnection
+
+    backend = Backend()
+    backend.connect_to_tool(ToolSerialConnection(serialport=port))
+    try:
+        backend.start_session(SessionConfig(DEVICE))
+        data = backend.read_memory(memory, offset, size)[0].data
+        backend.end_session()
+    finally:
+        backend.disconnect_from_tool()
+    return bytes(data)
+
+
+def unpackStats(raw, names):
+    """Turn the raw benchStats[] bytes into per-region statistics, less the cost of measuring
+
+    Args:
+        raw (bytes): contents of benchStats[], packed bench_stat_t structs
+        names (list): region names from regionNames()
+
+    Returns:
+        dict: {"min", "mean", "max", "runs", "overflows"} in CPU cycles per region name, for regions that ran.
+            Runs of 65536 cycles or more count as 65535 and in "overflows"
+    """
+    records = [STAT_FORMAT.unpack_from(raw, i * STAT_FORMAT.size) for i in range(len(names))]
+    overhead = records[0][0] if records[0][3] else 0
+
+    stats = {}
+    for name, (minCycles, maxCycles, totalCycles, runs, overflows) in zip(names[1:], records[1:]):
+        if runs:
+            stats[name] = {"min": max(0, minCycles - overhead),
+                           "mean": max(0.0, totalCycles / runs - overhead),
+                           "max": max(0, maxCycles - overhead),
+                           "runs": runs,
+                           "overflows": overflows}
+    return stats
+
+
+def bootCycles(raw, settings):
+    """Convert the boot time the firmware timed on the RTC into CPU cycles, to sit alongside the other regions
+
+    Args:
+        raw (bytes): contents of benchBootRtcCycles
+        settings (dict): F_CPU from main.h and TIMEBASE_RTC_HZ from Timebase.h
+
+    Returns:
+        dict: {"min", "mean", "max", "runs"} for the one boot, in CPU cycles
+    """
+    cycles = struct.unpack("<H", raw)[0] * settings["F_CPU"] // settings["TIMEBASE_RTC_HZ"]
+    return {"min": cycles, "mean": float(cycles), "max": cycles, "runs": 1, "overflows": 0}
+
+
+def printReport(stats, settings):
+    """Print the statistics table and the CPU headroom at the fastest audio sample rate
+
+    Args:
+        stats (dict): output of unpackStats()
+        settings (dict): F_CPU and the PWM period from main.h, and the fastest sample rate and ring buffer low water mark from Audio.h
+    """
+    print("{:<22}{:>10}{:>8}{:>10}{:>8}".format("region", "runs", "min", "mean", "max"))
+    for name, stat in stats.items():
+        print("{:<22}{:>10}{:>8}{:>10.1f}{:>8}".format(name, stat["runs"], stat["min"], stat["mean"], stat["max"]))
+    for name, stat in stats.items():
+        if stat.get("overflows"):
+            print("WARNING: {} ran past 65535 cycles {} times, its max and mean are lower bounds".format(name, stat["overflows"]))
+
+    cyclesPerSample = settings["F_CPU"] // settings["AUDIO_MAX_SAMPLE_RATE_HZ"]
+    cyclesPerPeriod = settings["AUDIO_PWM_PRESCALER"] * settings["AUDIO_PWM_PERIOD"]
+    # the ISR runs every PWM period and only loads a sample in some of them, see AUDIO_ISRS_PER_SAMPLE in Audio.c
+    isrsPerSample = -(-cyclesPerSample // cyclesPerPeriod)
+    print()
+    print("audio: at most {} Hz, {} cycles per sample, up to {} PWM periods of {} cycles each".format(
+        settings["AUDIO_MAX_SAMPLE_RATE_HZ"], cyclesPerSample, isrsPerSample, cyclesPerPeriod))
+    if "audio_isr" in stats:
+        audio = stats["audio_isr"]
+        print("  worst case ISR takes {} of the {} cycles of a PWM period".format(audio["max"], cyclesPerPeriod))
+        print("  worst case ISRs leave {} cycles ({:.0%}) of each sample period".format(
+            cyclesPerSample - audio["max"] * isrsPerSample, 1 - audio["max"] * isrsPerSample / cyclesPerSample))
+        print("  mean CPU load while playing {:.1%}".format(audio["mean"] / cyclesPerPeriod))
+    if "audio_fill" in stats:
+        ringCycles = settings["AUDIO_RING_LOW_WATER"] * cyclesPerSample
+        print("  worst case refill takes {} of the {} cycles the ring buffer has left when it asks".format(
+            stats["audio_fill"]["max"], ringCycles))
+    if "rtc_isr" in stats:
+        # 1000 interrupts/s while I2C is busy, only one per tick otherwise
+        print("tick: mean CPU load {:.2%} at 1000 interrupts/s, {:.2%} at {} interrupts/s".format(
+            stats["rtc_isr"]["mean"] * 1000 / settings["F_CPU"], stats["rtc_isr"]["mean"] * settings["TIMEBASE_TICK_HZ"] / settings["F_CPU"],
+            settings["TIMEBASE_TICK_HZ"]))
+    if "boot" in stats:
+        print("boot: armed {:.2f} ms after the RTC started, to within one RTC cycle".format(stats["boot"]["max"] * 1000 / settings["F_CPU"]))
+
+
+def compareBaseline(stats, baseline, tolerance):
+    """Flag regions whose mean or max cycles grew by more than 'tolerance' against a saved run
+
+    Args:
+        stats (dict): output of unpackStats() for this run
+        baseline (dict): output of unpackStats() from an earlier run
+        tolerance (float): allowed growth as a fraction, e.g. 0.05
+
+    Returns:
+        bool: True if nothing regressed
+    """
+    isClean = True
+    for name, stat in stats.items():
+        if name not in baseline:
+            continue
+        for key in ("mean", "max"):
+            before = baseline[name][key]
+            if stat[key] > before * (1 + tolerance) + 1:
+                print("REGRESSION: {} {} {:.1f} -> {:.1f} cycles".format(name, key, before, stat[key]))
+                isClean = False
+    return isClean
+
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+FW_DIR = os.path.join(SCRIPT_DIR, "..", "..", "AnnoyatronFW")
+DEVICE = "attiny1606"
+SRAM_START = 0x3C00  # ATtiny1606 data space address of the first SRAM byte
+STAT_FORMAT = struct.Struct("<HHIIH")  # bench_stat_t, packed little endian
+
+
+# Now just run the script with reasonable defaults if this script
+#   is invoked directly 
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Report the cycle statistics of a BENCHMARK firmware build")
+    parser.add_argument("--elf", default=os.path.join(SCRIPT_DIR, "build", "AnnoyatronFW.elf"), help="the BENCHMARK build that is on the board")
+    parser.add_argument("--port", default="/dev/ttyUSB0", help="serial port of the UPDI adapter")
+    parser.add_argument("--json", help="also save the statistics to this file")
+    parser.add_argument("--baseline", help="compare against statistics saved earlier with --json")
+    parser.add_argument("--tolerance", type=float, default=0.05, help="allowed growth over the baseline, as a fraction")
+    args = parser.parse_args()
+
+    names = regionNames()
+    offset, size = statsLocation(args.elf)
+    if size != len(names) * STAT_FORMAT.size:
+        print("ERROR: benchStats[] is {} bytes, expected {} for {} regions".format(size, len(names) * STAT_FORMAT.size, len(names)))
+        sys.exit(1)
+
+    stats = unpackStats(readStats(args.port, offset, size), names)
+    settings = readDefines(readHeader("main.h"), ("F_CPU", "AUDIO_PWM_PRESCALER", "AUDIO_PWM_PERIOD"))
+    settings.update(readDefines(readHeader("Audio.h"), ("AUDIO_MAX_SAMPLE_RATE_HZ", "AUDIO_RING_LEN")))
+    settings.update(readDefines(readHeader("Timebase.h"), ("TIMEBASE_RTC_HZ", "TIMEBASE_TICK_HZ")))
+    bootOffset, bootSize = statsLocation(args.elf, "benchBootRtcCycles")
+    stats["boot"] = bootCycles(readStats(args.port, bootOffset, bootSize), settings)
+    settings["AUDIO_RING_LOW_WATER"] = settings["AUDIO_RING_LEN"] // 2
+    printReport(stats, settings)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(stats, f, indent=2)
+
+    if args.baseline:
+        with open(args.baseline, "r") as f:
+            if not compareBaseline(stats, json.load(f), args.tolerance):
+                sys.exit(1)
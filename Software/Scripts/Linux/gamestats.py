@@ -0,0 +1,117 @@
+"""Game statistics read-out for the annoyatron firmware
+
+Reads the EEPROM of a board back over UPDI, finds the newest valid record in the ring that gamelog.c
+writes at the end of every game, and prints the totals in it: how often the board was armed, won, lost
+to a wrong wire or to the clock, which wrong wires get cut, and how long players take to cut.
+
+Run `make stats PORT=/dev/ttyUSB0` with the board powered down as for flashing. Save the raw EEPROM
+with --dump and report it again later with --load.
+"""
+import argparse  # Standard Python Library to parse command line arguments
+import struct  # Standard Python Library to unpack the records read from EEPROM
+import sys  # Standard Python Library to set the exit status
+
+import benchmark
+
+EEPROM_SIZE = 256  # ATtiny1606 EEPROM bytes
+EEPROM_PAGE_SIZE = 32  # ATtiny1606 EEPROM page bytes, one record per page
+CHECKSUM_SEED = 0x5A  # must match GAMELOG_CHECKSUM_SEED in gamelog.h
+
+
+def recordFormat(numWires):
+    """Build the layout of gamelog_record_t
+
+    Args:
+        numWires (int): NUM_CUT_WIRES from main.h
+
+    Returns:
+        struct.Struct: the packed little endian record
+    """
+    return struct.Struct("<BHHHH" + "H" * numWires + "IB")
+
+
+def newestRecord(raw, firstPage, numWires):
+    """Find the newest record in the ring whose checksum holds
+
+    Args:
+        raw (bytes): the whole EEPROM
+        firstPage (int): GAMELOG_FIRST_PAGE from gamelog.h
+        numWires (int): NUM_CUT_WIRES from main.h
+
+    Returns:
+        dict: the totals by field name and "slot", or None if no record is valid
+    """
+    layout = recordFormat(numWires)
+    newest = None
+    for slot in range(EEPROM_SIZE // EEPROM_PAGE_SIZE - firstPage):
+        address = (firstPage + slot) * EEPROM_PAGE_SIZE
+        data = raw[address:address + layout.size]
+        if (CHECKSUM_SEED + sum(data[:-1])) & 0xFF != data[-1]:
+            continue
+        values = layout.unpack(data)
+        record = {"slot": slot,
+                  "sequence": values[0],
+                  "arms": values[1],
+                  "wins": values[2],
+                  "losses": values[3],
+                  "timeouts": values[4],
+                  "wrongWires": list(values[5:5 + numWires]),
+                  "cutCentis": values[5 + numWires]}
+        # the sequence wraps at 256, the same int8_t comparison as gamelog_init()
+        if newest is None or 0 < (record["sequence"] - newest["sequence"]) & 0xFF < 0x80:
+            newest = record
+    return newest
+
+
+def printReport(record):
+    """Print the totals of a record
+
+    Args:
+        record (dict): output of newestRecord()
+
+    Returns:
+        None
+    """
+    if record is None:
+        print("no games logged yet")
+        return
+
+    games = record["wins"] + record["losses"] + record["timeouts"]
+    print("armed {} times, {} games (record {} in slot {})".format(record["arms"], games, record["sequence"], record["slot"]))
+    for name in ("wins", "losses", "timeouts"):
+        print("{:<10}{:>8}{:>9.1%}".format(name, record[name], record[name] / games if games else 0))
+    print()
+    print("{:<10}{:>8}".format("wrong wire", "cuts"))
+    for wire, count in enumerate(record["wrongWires"]):
+        print("{:<10}{:>8}".format(wire, count))
+    cuts = record["wins"] + record["losses"]
+    if cuts:
+        print()
+        print("average time to cut {:.2f} seconds".format(record["cutCentis"] / cuts / 100))
+
+
+# Now just run the script with reasonable defaults if this script
+#   is invoked directly
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Report the game statistics logged in a board's EEPROM")
+    parser.add_argument("--port", default="/dev/ttyUSB0", help="serial port of the UPDI adapter")
+    parser.add_argument("--dump", help="also save the raw EEPROM to this file")
+    parser.add_argument("--load", help="report a raw EEPROM saved earlier with --dump instead of reading the board")
+    args = parser.parse_args()
+
+    numWires = benchmark.readDefines(benchmark.readHeader("main.h"), ("NUM_CUT_WIRES",))["NUM_CUT_WIRES"]
+    firstPage = benchmark.readDefines(benchmark.readHeader("gamelog.h"), ("GAMELOG_FIRST_PAGE",))["GAMELOG_FIRST_PAGE"]
+    if args.load:
+        with open(args.load, "rb") as f:
+            raw = f.read()
+    else:
+        raw = benchmark.readStats(args.port, 0, EEPROM_SIZE, "eeprom")
+    if len(raw) != EEPROM_SIZE:
+        print("ERROR: read {} bytes of EEPROM, expected {}".format(len(raw), EEPROM_SIZE))
+        sys.exit(1)
+
+    if args.dump:
+        with open(args.dump, "wb") as f:
+            f.write(raw)
+
+    printReport(newestRecord(raw, firstPage, numWires))
@@ -0,0 +1,245 @@
+"""Battery draw estimate for the annoyatron firmware
+
+Reads the residency counters that a POWER_PROFILE build of the firmware keeps in SRAM (see power.h)
+back over UPDI, and prints how long the board spent in each board state and each sleep mode. It then
+combines them with the currents of the parts on the board into an average current and mAh per day off
+the 9V battery.
+
+The currents below are ballpark figures from the datasheets listed in Hardware/Annoyatron_v2_BOM.csv. The
+regulators and power LEDs draw from the battery all the time, whatever the firmware does, so measure a
+board and pass its own figures with --mode-current, --state-current and --baseline-current to refine them.
+
+Flash a profiling build with `make POWER_PROFILE=1 flash`, leave the board where it will be used for a
+while, then run `make power`. Save a run with --json and report it again later with --load.
+--pir-low-ms estimates what a different PIR_LOW_COUNT_TO_SLEEP would have drawn over the same run.
+"""
+import argparse  # Standard Python Library to parse command line arguments
+import json  # Standard Python Library to save and reload profiles
+import os  # Standard Python Library to locate files relative to this script
+import re  # Standard Python Library to read settings out of the firmware sources
+import struct  # Standard Python Library to unpack the counters read from SRAM
+import sys  # Standard Python Library to set the exit status
+
+import benchmark
+
+# ATtiny1606 supply current in mA per power_mode_t at F_CPU, from the tinyAVR 1-series datasheet
+MODE_MA = {
+    "active": 3.0,
+    "idle": 1.2,
+    "standby": 0.001,  # RTC running on OSCULP32K
+    "pwr_down": 0.001,  # PIT running on OSCULP32K
+}
+
+# Extra current in mA drawn in each board state by the display, amplifier and LED
+STATE_MA = {
+    "wire_setup": 5.0,  # display blinking dashes
+    "sleep": 0.0,
+    "waiting": 2.0,  # user LED on
+    "countdown": 50.0,  # display, siren through the PAM8302 and the blinking LED
+    "success": 45.0,  # display and clip
+    "failure": 45.0,  # display and clip
+    "done": 10.0,  # the display is left blinking the result
+}
+
+# Current in mA drawn from the battery whatever the firmware does: the ground current of the two
+# NCP1117 regulators, the two power rail LEDs and the PIR sensor
+BASELINE_MA = 2 * 5.0 + 2 * 1.0 + 0.015
+
+BATTERY_MAH = 550  # a typical alkaline 9V battery
+MS_PER_DAY = 24 * 3600 * 1000
+
+
+def counterNames():
+    """List the board states and power modes in the order powerStats keeps them
+
+    Returns:
+        tuple: (state names, mode names) without their enum prefixes
+    """
+    states = benchmark.readEnum(benchmark.readHeader("main.h"), "board_state_t")
+    modes = benchmark.readEnum(benchmark.readHeader("power.h"), "power_mode_t")
+    states = [state[len("board_state_"):] for state in states if state != "board_state_count"]
+    modes = [mode[len("power_mode_"):] for mode in modes if mode != "power_mode_count"]
+    return states, modes
+
+
+def unpackProfile(raw, states, modes):
+    """Turn the raw powerStats bytes into named counters
+
+    Args:
+        raw (bytes): contents of powerStats, a packed power_stats_t
+        states (list): board state names from counterNames()
+        modes (list): power mode names from counterNames()
+
+    Returns:
+        dict: {"stateMs", "modeMs", "sleeps"} by name, and "pirWakeups"
+    """
+    values = struct.unpack("<" + "I" * (len(states) + 2 * len(modes) + 1), raw)
+    stateMs = values[:len(states)]
+    modeMs = values[len(states):len(states) + len(modes)]
+    sleeps = values[len(states) + len(modes):len(states) + 2 * len(modes)]
+    return {"stateMs": dict(zip(states, stateMs)),
+            "modeMs": dict(zip(modes, modeMs)),
+            "sleeps": dict(zip(modes, sleeps)),
+            "pirWakeups": values[-1]}
+
+
+def pirLowMs():
+    """Read PIR_LOW_COUNT_TO_SLEEP from main.h
+
+    Returns:
+        int: msec of no motion the board waits before going back to sleep
+    """
+    match = re.search(r"#define\s+PIR_LOW_COUNT_TO_SLEEP\s+TIMEBASE_MS_TO_TICKS\((\d+)\)", benchmark.readHeader("main.h"))
+    if match is None:
+        raise ValueError("could not find PIR_LOW_COUNT_TO_SLEEP in main.h")
+    return int(match.group(1))
+
+
+def retimePirLow(profile, oldMs, newMs):
+    """Estimate the same run with a different PIR_LOW_COUNT_TO_SLEEP
+
+    A PIR wakeup that does not lead to a game spends its last PIR_LOW_COUNT_TO_SLEEP msec waiting for
+    motion that never comes. That time moves between waiting, where the CPU is in STANDBY, and sleep,
+    where it is in PWR_DOWN. The counters do not say which wakeups led to a game, so every wakeup is
+    taken to be one that did not, which overstates the change slightly on a board that was played with.
+
+    Args:
+        profile (dict): output of unpackProfile()
+        oldMs (int): PIR_LOW_COUNT_TO_SLEEP the run was made with, in msec
+        newMs (int): PIR_LOW_COUNT_TO_SLEEP to estimate, in msec
+
+    Returns:
+        dict: the adjusted profile
+    """
+    shift = min(profile["pirWakeups"] * (oldMs - newMs), profile["stateMs"]["waiting"], profile["modeMs"]["standby"])
+    shift = max(shift, -min(profile["stateMs"]["sleep"], profile["modeMs"]["pwr_down"]))
+    adjusted = json.loads(json.dumps(profile))
+    adjusted["stateMs"]["waiting"] -= shift
+    adjusted["stateMs"]["sleep"] += shift
+    adjusted["modeMs"]["standby"] -= shift
+    adjusted["modeMs"]["pwr_down"] += shift
+    return adjusted
+
+
+def estimateCharge(profile, modeMa, stateMa, baselineMa):
+    """Work out the charge drawn from the battery over the run
+
+    Args:
+        profile (dict): output of unpackProfile()
+        modeMa (dict): MCU current per power mode in mA
+        stateMa (dict): extra current per board state in mA
+        baselineMa (float): current drawn all the time in mA
+
+    Returns:
+        dict: charge in mA*msec by source, with "mcu <mode>", "board <state>" and "baseline" entries
+    """
+    totalMs = sum(profile["modeMs"].values())
+    charge = {"baseline": baselineMa * totalMs}
+    for mode, ms in profile["modeMs"].items():
+        charge["mcu " + mode] = modeMa[mode] * ms
+    for state, ms in profile["stateMs"].items():
+        charge["board " + state] = stateMa[state] * ms
+    return charge
+
+
+def printReport(profile, charge, batteryMah):
+    """Print the residency tables and the battery estimate
+
+    Args:
+        profile (dict): output of unpackProfile()
+        charge (dict): output of estimateCharge()
+        batteryMah (float): battery capacity in mAh
+
+    Returns:
+        None
+    """
+    totalMs = sum(profile["modeMs"].values())
+    if not totalMs:
+        print("no time recorded yet, leave the board running for a while")
+        return
+
+    print("{:<14}{:>14}{:>9}".format("state", "seconds", "share"))
+    for state, ms in profile["stateMs"].items():
+        print("{:<14}{:>14.1f}{:>9.1%}".format(state, ms / 1000, ms / totalMs))
+    print()
+    print("{:<14}{:>14}{:>9}{:>12}".format("mode", "seconds", "share", "sleeps"))
+    for mode, ms in profile["modeMs"].items():
+        print("{:<14}{:>14.1f}{:>9.1%}{:>12}".format(mode, ms / 1000, ms / totalMs, profile["sleeps"][mode] or ""))
+    print()
+    print("PIR wakeups: {} ({:.1f} per day)".format(profile["pirWakeups"], profile["pirWakeups"] * MS_PER_DAY / totalMs))
+    print()
+
+    totalCharge = sum(charge.values())
+    print("{:<20}{:>12}".format("drawn by", "share"))
+    for source, value in sorted(charge.items(), key=lambda item: -item[1]):
+        if value:
+            print("{:<20}{:>12.1%}".format(source, value / totalCharge))
+    averageMa = totalCharge / totalMs
+    mahPerDay = averageMa * 24
+    print()
+    print("average {:.3f} mA, {:.1f} mAh per day, {:.1f} days on a {} mAh battery".format(
+        averageMa, mahPerDay, batteryMah / mahPerDay, batteryMah))
+
+
+def parseCurrents(pairs, defaults, what):
+    """Override default currents with name=mA pairs from the command line
+
+    Args:
+        pairs (list): "name=mA" strings
+        defaults (dict): current per name in mA
+        what (string): what the names are, for the error message
+
+    Returns:
+        dict: the currents with the overrides applied
+    """
+    currents = dict(defaults)
+    for pair in pairs or []:
+        name, _, value = pair.partition("=")
+        if name not in currents:
+            raise ValueError("unknown " + what + " " + name + ", expected one of " + ", ".join(currents))
+        currents[name] = float(value)
+    return currents
+
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+
+# Now just run the script with reasonable defaults if this script
+#   is invoked directly
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Estimate battery draw from a POWER_PROFILE firmware build")
+    parser.add_argument("--elf", default=os.path.join(SCRIPT_DIR, "build", "AnnoyatronFW.elf"), help="the POWER_PROFILE build that is on the board")
+    parser.add_argument("--port", default="/dev/ttyUSB0", help="serial port of the UPDI adapter")
+    parser.add_argument("--json", help="also save the counters to this file")
+    parser.add_argument("--load", help="report counters saved earlier with --json instead of reading the board")
+    parser.add_argument("--mode-current", action="append", metavar="MODE=MA", help="MCU current in a power mode")
+    parser.add_argument("--state-current", action="append", metavar="STATE=MA", help="extra board current in a board state")
+    parser.add_argument("--baseline-current", type=float, default=BASELINE_MA, help="current drawn all the time in mA")
+    parser.add_argument("--battery-mah", type=float, default=BATTERY_MAH, help="battery capacity in mAh")
+    parser.add_argument("--pir-low-ms", type=int, help="estimate the run with this PIR_LOW_COUNT_TO_SLEEP in msec")
+    args = parser.parse_args()
+
+    states, modes = counterNames()
+    if args.load:
+        with open(args.load, "r") as f:
+            profile = json.load(f)
+    else:
+        offset, size = benchmark.statsLocation(args.elf, "powerStats", "POWER_PROFILE=1")
+        if size != 4 * (len(states) + 2 * len(modes) + 1):
+            print("ERROR: powerStats is {} bytes, expected {} for {} states and {} modes".format(
+                size, 4 * (len(states) + 2 * len(modes) + 1), len(states), len(modes)))
+            sys.exit(1)
+        profile = unpackProfile(benchmark.readStats(args.port, offset, size), states, modes)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(profile, f, indent=2)
+
+    if args.pir_low_ms is not None:
+        oldMs = pirLowMs()
+        print("as if PIR_LOW_COUNT_TO_SLEEP were {} msec instead of {}\n".format(args.pir_low_ms, oldMs))
+        profile = retimePirLow(profile, oldMs, args.pir_low_ms)
+
+    modeMa = parseCurrents(args.mode_current, MODE_MA, "power mode")
+    stateMa = parseCurrents(args.state_current, STATE_MA, "board state")
+    printReport(profile, estimateCharge(profile, modeMa, stateMa, args.baseline_current), args.battery_mah)
@@ -0,0 +1,230 @@
+"""Statistical check of the annoyatron's random generator
+
+Runs a copy of random.c on the PC: the entropy mixing of random_gatherEntropy(), the EEPROM seed that
+random_init() carries from boot to boot, and the bounded draws of random_below() that deal the game
+rules. It then checks with chi-square tests that the rules come out evenly, both over one long run and
+over the first deal of many boots, and that a deal says nothing about the next one.
+
+The ADC and clock readings are simulated as a fixed value with a few random low bits. Run it again with
+--noise-bits 0 --jitter-bits 0 to see the deals still move on from boot to boot off the EEPROM seed
+alone, when the pin and the clocks read exactly the same every time. Run `make randomstats`, and see
+--help for the sizes of the runs.
+"""
+import argparse  # Standard Python Library to parse command line arguments
+import math  # Standard Python Library for the chi-square p-values
+import random  # Standard Python Library to simulate the ADC noise and clock jitter
+import sys  # Standard Python Library to set the exit status
+
+import benchmark
+
+MASK32 = 0xFFFFFFFF
+FALLBACK_STATE = 0x2545F491  # must match RANDOM_FALLBACK_STATE in random.h
+
+
+def xorshift32(x):
+    """Step the xorshift generator, as xorshift32() in random.c
+
+    Args:
+        x (int): the current state, not zero
+
+    Returns:
+        int: the next state
+    """
+    x ^= (x << 13) & MASK32
+    x ^= x >> 17
+    x ^= (x << 5) & MASK32
+    return x
+
+
+class Board:
+    """One board's generator and the EEPROM seed it keeps across boots"""
+
+    def __init__(self, numSamples):
+        self.numSamples = numSamples
+        self.eepromSeed = 0xFFFFFFFF  # erased EEPROM
+        self.state = FALLBACK_STATE
+
+    def gatherEntropy(self, readings):
+        """Mix (ADC result, TCB0 count) pairs as random_gatherEntropy() does
+
+        Args:
+            readings (iterable): numSamples pairs of (10 bit ADC result, 16 bit TCB0 count)
+
+        Returns:
+            int: the gathered entropy
+        """
+        pool = 0
+        for adc, jitter in readings:
+            pool = xorshift32(pool ^ ((jitter << 16) | adc))
+        return pool
+
+    def init(self, entropy):
+        """Seed the generator and write the next boot's seed, as random_init()
+
+        Args:
+            entropy (int): entropy from gatherEntropy()
+
+        Returns:
+            None
+        """
+        self.state = xorshift32(entropy ^ self.eepromSeed)
+        if not self.state:
+            self.state = FALLBACK_STATE
+        self.state = xorshift32(self.state)
+        self.eepromSeed = xorshift32(self.state ^ FALLBACK_STATE)
+
+    def random(self):
+        """Draw 16 bits, as random()"""
+        self.state = xorshift32(self.state)
+        return self.state >> 16
+
+    def randomBelow(self, bound):
+        """Draw a number below 'bound', as random_below()"""
+        threshold = 65536 % bound
+        while True:
+            draw = self.random()
+            if draw >= threshold:
+                return draw % bound
+
+
+def simulatedReadings(rng, numSamples, noiseBits, jitterBits):
+    """Make up one boot's worth of ADC results and TCB0 counts
+
+    Args:
+        rng (random.Random): source of the simulated noise
+        numSamples (int): RANDOM_ENTROPY_SAMPLES
+        noiseBits (int): low bits of each ADC result that are noise
+        jitterBits (int): low bits of each TCB0 count that are jitter
+
+    Returns:
+        list: (ADC result, TCB0 count) pairs
+    """
+    readings = []
+    count = 0
+    for _ in range(numSamples):
+        # a floating pin near mid rail, and about 305 CPU clocks at 10 MHz between 32768 Hz RTC edges
+        adc = 0x200 ^ rng.getrandbits(noiseBits)
+        count = (count + 305 + rng.getrandbits(jitterBits)) & 0xFFFF
+        readings.append((adc, count))
+    return readings
+
+
+def chiSquarePValue(stat, dof):
+    """Chance of a chi-square at least 'stat' with 'dof' degrees of freedom, by the regularized gamma
+
+    Args:
+        stat (float): the chi-square statistic
+        dof (int): degrees of freedom
+
+    Returns:
+        float: the p-value
+    """
+    a = dof / 2
+    x = stat / 2
+    if x <= 0:
+        return 1.0
+    logPrefix = a * math.log(x) - x - math.lgamma(a)
+    if x < a + 1:
+        # lower gamma series, then take the complement
+        term = total = 1 / a
+        n = a
+        while abs(term) > abs(total) * 1e-15:
+            n += 1
+            term *= x / n
+            total += term
+        return max(0.0, 1 - total * math.exp(logPrefix))
+    # upper gamma continued fraction, Lentz's method
+    tiny = 1e-300
+    b = x + 1 - a
+    c = 1 / tiny
+    d = 1 / b
+    h = d
+    for i in range(1, 1000):
+        an = -i * (i - a)
+        b += 2
+        d = an * d + b
+        d = tiny if abs(d) < tiny else d
+        c = b + an / c
+        c = tiny if abs(c) < tiny else c
+        d = 1 / d
+        h *= d * c
+        if abs(d * c - 1) < 1e-15:
+            break
+    return h * math.exp(logPrefix)
+
+
+def chiSquare(counts):
+    """Test counts against an even spread
+
+    Args:
+        counts (list): how often each value came up
+
+    Returns:
+        tuple: (chi-square statistic, p-value)
+    """
+    expected = sum(counts) / len(counts)
+    stat = sum((count - expected) ** 2 / expected for count in counts)
+    return stat, chiSquarePValue(stat, len(counts) - 1)
+
+
+def report(name, counts, alpha):
+    """Print one test and say whether it passed
+
+    Args:
+        name (string): what was counted
+        counts (list): how often each value came up
+        alpha (float): p-value below which the test fails
+
+    Returns:
+        bool: True if it passed
+    """
+    stat, pValue = chiSquare(counts)
+    passed = pValue >= alpha
+    print("{:<40} chi2 {:>10.1f}  dof {:>4}  p {:.4f}  {}".format(name, stat, len(counts) - 1, pValue,
+                                                                  "ok" if passed else "FAIL"))
+    return passed
+
+
+# Now just run the script with reasonable defaults if this script
+#   is invoked directly
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Check the annoyatron's random deals for an even spread")
+    parser.add_argument("--bounds", default="3,4,12", help="bounds to draw below, the game mode table sizes by default")
+    parser.add_argument("--draws", type=int, default=200000, help="draws in the one long run per bound")
+    parser.add_argument("--boots", type=int, default=20000, help="boots to simulate for the first deal tests")
+    parser.add_argument("--noise-bits", type=int, default=2, help="low bits of each ADC result that are noise")
+    parser.add_argument("--jitter-bits", type=int, default=1, help="low bits of each TCB0 count that are jitter")
+    parser.add_argument("--alpha", type=float, default=0.001, help="p-value below which a test fails")
+    parser.add_argument("--sim-seed", type=int, default=1, help="seed of the simulated noise, for repeatable runs")
+    args = parser.parse_args()
+
+    numSamples = benchmark.readDefines(benchmark.readHeader("random.h"), ("RANDOM_ENTROPY_SAMPLES",))["RANDOM_ENTROPY_SAMPLES"]
+    bounds = [int(bound) for bound in args.bounds.split(",")]
+    rng = random.Random(args.sim_seed)
+    allPassed = True
+
+    print("{} samples per boot, {} noise bits, {} jitter bits".format(numSamples, args.noise_bits, args.jitter_bits))
+    for bound in bounds:
+        # one long run off a single boot, and each deal against the one after it
+        board = Board(numSamples)
+        board.init(board.gatherEntropy(simulatedReadings(rng, numSamples, args.noise_bits, args.jitter_bits)))
+        counts = [0] * bound
+        pairs = [0] * (bound * bound)
+        last = board.randomBelow(bound)
+        for _ in range(args.draws):
+            draw = board.randomBelow(bound)
+            counts[draw] += 1
+            pairs[last * bound + draw] += 1
+            last = draw
+        allPassed &= report("below {}, one run".format(bound), counts, args.alpha)
+        allPassed &= report("below {}, each deal against the next".format(bound), pairs, args.alpha)
+
+        # the first deal after each boot, one board powered up over and over
+        board = Board(numSamples)
+        counts = [0] * bound
+        for _ in range(args.boots):
+            board.init(board.gatherEntropy(simulatedReadings(rng, numSamples, args.noise_bits, args.jitter_bits)))
+            counts[board.randomBelow(bound)] += 1
+        allPassed &= report("below {}, first deal of each boot".format(bound), counts, args.alpha)
+
+    sys.exit(0 if allPassed else 1)
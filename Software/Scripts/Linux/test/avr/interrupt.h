@@ -0,0 +1,18 @@
+/*!
+ * @file avr/interrupt.h
+ *
+ * Stand-in for avr-libc's avr/interrupt.h for the host tests. An ISR becomes a plain function the test
+ * calls by its vector name, and cli() and sei() only flip the I bit in the fake SREG
+ *
+ */
+
+#ifndef TEST_AVR_INTERRUPT_H_
+#define TEST_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+#define ISR(vector) void vector(void)
+#define cli() (SREG &= (uint8_t) ~CPU_I_bm)
+#define sei() (SREG |= CPU_I_bm)
+
+#endif /* TEST_AVR_INTERRUPT_H_ */
@@ -0,0 +1,84 @@
+/*!
+ * @file avr/io.h
+ *
+ * Stand-in for avr-libc's avr/io.h so the host tests can build firmware sources with the PC's compiler.
+ * Only the registers and bits those sources use are here, as plain memory the tests set and inspect.
+ * The bit values match the ATtiny1606 header, but writing a flag does not clear it as on the part
+ *
+ */
+
+#ifndef TEST_AVR_IO_H_
+#define TEST_AVR_IO_H_
+
+#include <stdint.h>
+
+/** Two-wire interface registers, master side only */
+typedef struct TWI_struct
+{
+   volatile uint8_t MCTRLA;  ///< Master control A
+   volatile uint8_t MCTRLB;  ///< Master control B
+   volatile uint8_t MSTATUS;  ///< Master status
+   volatile uint8_t MBAUD;  ///< Master baud rate
+   volatile uint8_t MADDR;  ///< Master address
+   volatile uint8_t MDATA;  ///< Master data
+} TWI_t;
+
+/** I/O port registers */
+typedef struct PORT_struct
+{
+   volatile uint8_t DIR;  ///< Data direction
+   volatile uint8_t DIRSET;  ///< Data direction set
+   volatile uint8_t DIRCLR;  ///< Data direction clear
+   volatile uint8_t OUT;  ///< Output value
+   volatile uint8_t OUTSET;  ///< Output value set
+   volatile uint8_t OUTCLR;  ///< Output value clear
+   volatile uint8_t PIN0CTRL;  ///< Pin 0 control
+   volatile uint8_t PIN1CTRL;  ///< Pin 1 control
+} PORT_t;
+
+/** Sleep controller registers */
+typedef struct SLPCTRL_struct
+{
+   volatile uint8_t CTRLA;  ///< Control A
+} SLPCTRL_t;
+
+extern TWI_t TWI0;
+extern PORT_t PORTB;
+extern SLPCTRL_t SLPCTRL;
+extern volatile uint8_t SREG;
+
+#define CPU_I_bm 0x80
+
+#define PIN0_bm 0x01
+#define PIN1_bm 0x02
+#define PIN2_bm 0x04
+#define PORT_PULLUPEN_bm 0x08
+#define PORT_INVEN_bm 0x80
+#define PORT_ISC_INTDISABLE_gc 0x00
+
+#define TWI_ENABLE_bp 0
+#define TWI_SMEN_bp 1
+#define TWI_QCEN_bp 4
+#define TWI_WIEN_bp 6
+#define TWI_WIEN_bm 0x40
+#define TWI_RIEN_bp 7
+#define TWI_RIEN_bm 0x80
+#define TWI_TIMEOUT_DISABLED_gc 0x00
+
+#define TWI_MCMD_REPSTART_gc 0x01
+#define TWI_MCMD_RECVTRANS_gc 0x02
+#define TWI_MCMD_STOP_gc 0x03
+#define TWI_ACKACT_bp 2
+#define TWI_ACKACT_NACK_gc 0x04
+#define TWI_FLUSH_bm 0x08
+
+#define TWI_BUSSTATE_gm 0x03
+#define TWI_BUSSTATE_IDLE_gc 0x01
+#define TWI_BUSSTATE_OWNER_gc 0x02
+#define TWI_BUSERR_bm 0x04
+#define TWI_ARBLOST_bm 0x08
+#define TWI_RXACK_bm 0x10
+#define TWI_WIF_bm 0x40
+#define TWI_RIF_bm 0x80
+
+#endif /* TEST_AVR_IO_H_ */
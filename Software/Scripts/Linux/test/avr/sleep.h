@@ -0,0 +1,22 @@
+/*!
+ * @file avr/sleep.h
+ *
+ * Stand-in for avr-libc's avr/sleep.h for the host tests, sleeping does nothing
+ *
+ */
+
+#ifndef TEST_AVR_SLEEP_H_
+#define TEST_AVR_SLEEP_H_
+
+#include <avr/io.h>
+
+#define SLEEP_MODE_IDLE 0x00
+#define SLEEP_MODE_STANDBY 0x02
+#define SLEEP_MODE_PWR_DOWN 0x04
+
+#define set_sleep_mode(mode) (SLPCTRL.CTRLA = (mode))
+#define sleep_enable()
+#define sleep_disable()
+#define sleep_cpu()
+
+#endif /* TEST_AVR_SLEEP_H_ */
@@ -0,0 +1,300 @@
+/*!
+ * @file i2ctest.c
+ *
+ * Host test of the I2C transaction queue in I2C.c, built against the fake registers in test/avr and run by
+ * `make i2ctest`. The test plays the TWI0 hardware: it sets MSTATUS and calls the TWI0 ISR the way the part
+ * would, and checks that the bus recovery, which busy-waits for about 90 usec, only ever runs from
+ * I2C_service() in the main loop and never in the ISR
+ *
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <avr/io.h>
+
+#include "I2C.h"
+#include "Timebase.h"
+#include "trace.h"
+
+#define TEST_ADDR_A 0xE0  ///< Slave address of the first transaction
+#define TEST_ADDR_B 0xE2  ///< Slave address of the second transaction
+#define NO_STATUS 0xEE  ///< Callback status before the callback has run
+
+TWI_t TWI0;
+PORT_t PORTB;
+SLPCTRL_t SLPCTRL;
+volatile uint8_t SREG = CPU_I_bm;
+
+void TWI0_TWIM_vect(void);
+
+static bool inIsr;  ///< The test is inside TWI0_TWIM_vect()
+static bool busError;  ///< TWI0 sees a bus error when the next transaction starts
+static unsigned delaysInIsr;  ///< _delay_us() calls made from the ISR, must stay 0
+static unsigned delaysInLoop;  ///< _delay_us() calls made from the main loop, i.e. bus recoveries
+static uint8_t statusA;  ///< Status the first transaction completed with
+static uint8_t statusB;  ///< Status the second transaction completed with
+static bool calledInIsrB;  ///< The second transaction completed from the ISR
+static unsigned failures;  ///< Checks that failed
+
+/*!
+ * @brief Count a busy-wait, by where it was made from
+ *
+ * @param us
+ *  Unused, the wait is not timed
+ *
+ * @return None
+ */
+void test_delay_us(double us)
+{
+   (void) us;
+   if (inIsr)
+   {
+      delaysInIsr++;
+   }
+   else
+   {
+      delaysInLoop++;
+   }
+}
+
+/*!
+ * @brief I2C_begin() calls this just before it sends the address, which is where the fake bus decides whether
+ *  the start sees a bus error. The flags in the fake MSTATUS are not cleared by writing them as on the part
+ *
+ * @param None
+ *
+ * @return None
+ */
+void timebase_needMs(void)
+{
+   TWI0.MSTATUS = busError ? TWI_BUSERR_bm : 0;
+}
+
+/*!
+ * @brief Swallow trace records, the test checks the callbacks instead
+ *
+ * @param type
+ *  Unused
+ *
+ * @param arg
+ *  Unused
+ *
+ * @return None
+ */
+void trace_emit(trace_type_t type, uint8_t arg)
+{
+   (void) type;
+   (void) arg;
+}
+
+/*!
+ * @brief Completion callback of the first transaction
+ *
+ * @param status
+ *  The transaction's I2C status code
+ *
+ * @return None
+ */
+static void doneA(uint8_t status)
+{
+   statusA = status;
+}
+
+/*!
+ * @brief Completion callback of the second transaction
+ *
+ * @param status
+ *  The transaction's I2C status code
+ *
+ * @return None
+ */
+static void doneB(uint8_t status)
+{
+   statusB = status;
+   calledInIsrB = inIsr;
+}
+
+/*!
+ * @brief Raise the TWI0 master interrupt with 'status' in MSTATUS, with interrupts disabled as on the part
+ *
+ * @param status
+ *  MSTATUS flags the hardware has set
+ *
+ * @return None
+ */
+static void runIsr(uint8_t status)
+{
+   uint8_t sreg = SREG;
+
+   TWI0.MSTATUS = status;
+   SREG &= (uint8_t) ~CPU_I_bm;
+   inIsr = true;
+   TWI0_TWIM_vect();
+   inIsr = false;
+   SREG = sreg;
+}
+
+/*!
+ * @brief Clock a one byte write through the ISR: register, data, then the STOP
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void runWrite(void)
+{
+   uint8_t i;
+
+   for (i = 0; i < 3; i++)
+   {
+      runIsr(TWI_WIF_bm);
+   }
+}
+
+/*!
+ * @brief Record a failed check
+ *
+ * @param isPassed
+ *  The checked condition
+ *
+ * @param what
+ *  What was checked
+ *
+ * @return None
+ */
+static void check(bool isPassed, const char *what)
+{
+   if (!isPassed)
+   {
+      printf("FAIL: %s\n", what);
+      failures++;
+   }
+}
+
+/*!
+ * @brief Start each scenario from an idle, healthy bus
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void reset(void)
+{
+   I2C_init();
+   busError = false;
+   TWI0.MSTATUS = 0;
+   delaysInIsr = 0;
+   delaysInLoop = 0;
+   statusA = NO_STATUS;
+   statusB = NO_STATUS;
+   calledInIsrB = false;
+}
+
+/*!
+ * @brief A transaction queued behind one that ends in a bus error is restarted by I2C_service() once the bus
+ *  is recovered, and not from the ISR that retired the one before it
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void testQueuedAfterBusError(void)
+{
+   const uint8_t data = 0x5A;
+
+   reset();
+   I2C_queue_write(TEST_ADDR_A, 0x00, &data, 1, doneA);
+   I2C_queue_write(TEST_ADDR_B, 0x00, &data, 1, doneB);
+
+   // A finishes from the ISR, which then finds the bus faulted as it starts B
+   busError = true;
+   runWrite();
+   check(statusA == 0, "the first transaction completes");
+   check(statusB == NO_STATUS, "the second transaction waits for the recovery");
+   check(delaysInIsr == 0, "no bus recovery in the ISR after a failed start");
+   check(!(TWI0.MCTRLA & (TWI_RIEN_bm | TWI_WIEN_bm)), "TWI0 interrupts are off until the recovery");
+   check(I2C_is_busy(), "the second transaction is still queued");
+
+   busError = false;
+   I2C_service();
+   check(delaysInLoop > 0, "I2C_service() recovers the bus");
+   check(TWI0.MADDR == TEST_ADDR_B, "I2C_service() restarts the second transaction");
+   check((TWI0.MCTRLA & (TWI_RIEN_bm | TWI_WIEN_bm)) == (TWI_RIEN_bm | TWI_WIEN_bm), "TWI0 interrupts are back on");
+
+   runWrite();
+   check(statusB == 0, "the restarted transaction completes");
+   check(!I2C_is_busy(), "the queue drains");
+   check(delaysInIsr == 0, "no bus recovery in the ISR");
+}
+
+/*!
+ * @brief A bus error while a transaction is on the bus leaves it for I2C_service() to recover the bus and complete
+ *  it with status 4, and the transaction behind it starts from there
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void testBusErrorMidTransaction(void)
+{
+   const uint8_t data = 0x5A;
+
+   reset();
+   I2C_queue_write(TEST_ADDR_A, 0x00, &data, 1, doneA);
+   I2C_queue_write(TEST_ADDR_B, 0x00, &data, 1, doneB);
+
+   runIsr(TWI_WIF_bm);
+   runIsr(TWI_BUSERR_bm);
+   check(statusA == NO_STATUS, "the failed transaction is left for I2C_service()");
+   check(delaysInIsr == 0, "no bus recovery in the ISR after a bus error");
+
+   I2C_service();
+   check(statusA == 4, "I2C_service() completes the failed transaction with the bus error");
+   check(delaysInLoop > 0, "I2C_service() recovers the bus");
+   check(TWI0.MADDR == TEST_ADDR_B, "the next transaction starts");
+
+   runWrite();
+   check(statusB == 0, "the next transaction completes");
+   check(!I2C_is_busy(), "the queue drains");
+}
+
+/*!
+ * @brief A transaction whose start still fails after the recovery is completed with status 4 from I2C_service(),
+ *  rather than retried for ever
+ *
+ * @param None
+ *
+ * @return None
+ */
+static void testBusStuck(void)
+{
+   const uint8_t data = 0x5A;
+
+   reset();
+   I2C_queue_write(TEST_ADDR_A, 0x00, &data, 1, doneA);
+   I2C_queue_write(TEST_ADDR_B, 0x00, &data, 1, doneB);
+
+   busError = true;
+   runWrite();
+   I2C_service();
+   check(statusB == 4, "a start that fails again completes with the bus error");
+   check(!calledInIsrB, "and completes from I2C_service()");
+   check(!I2C_is_busy(), "the queue drains");
+   check(delaysInIsr == 0, "no bus recovery in the ISR");
+}
+
+int main(void)
+{
+   testQueuedAfterBusError();
+   testBusErrorMidTransaction();
+   testBusStuck();
+
+   if (failures)
+   {
+      printf("%u checks failed\n", failures);
+      return 1;
+   }
+   printf("I2C queue: all checks passed\n");
+   return 0;
+}
@@ -0,0 +1,16 @@
+/*!
+ * @file util/delay.h
+ *
+ * Stand-in for avr-libc's util/delay.h for the host tests. Busy-waits are counted rather than waited
+ * out, see test_delay_us() in the test that includes this
+ *
+ */
+
+#ifndef TEST_UTIL_DELAY_H_
+#define TEST_UTIL_DELAY_H_
+
+void test_delay_us(double us);
+
+#define _delay_us(us) test_delay_us(us)
+
+#endif /* TEST_UTIL_DELAY_H_ */
@@ -0,0 +1,169 @@
+"""Trace decoder for the annoyatron firmware
+
+Turns the binary trace the firmware sends on USART0 (see trace.h) into a timeline of resets, state
+changes, PIR edges, wire cuts and I2C errors. Either listen on a serial adapter whose RX is wired to the
+trace pin, or decode a capture saved earlier.
+
+The trace runs at TRACE_BAUD, 8N1. Run `make trace TRACE_PORT=/dev/ttyUSB1` to follow a board live, and
+add --capture to keep the raw bytes. Times are msec since reset that the board spent awake, the RTC
+does not count in PWR_DOWN.
+"""
+import argparse  # Standard Python Library to parse command line arguments
+import sys  # Standard Python Library to write the timeline as it arrives
+
+import benchmark
+
+RECORD_LEN = 5  # must match TRACE_RECORD_LEN in trace.h
+SYNC = 0xA5  # must match TRACE_SYNC in trace.h
+
+# I2C status codes handed to the I2C callbacks, see I2C.c
+I2C_STATUS = {1: "NACK", 4: "bus error", 8: "bus contention", 0xFF: "timeout"}
+
+# RSTCTRL.RSTFR bits, from the tinyAVR 1-series datasheet
+RESET_FLAGS = ((0x01, "power on"), (0x02, "brown out"), (0x04, "reset pin"), (0x08, "watchdog"),
+               (0x10, "software"), (0x20, "UPDI"))
+
+
+def traceNames():
+    """List the record types and board states in the order the firmware numbers them
+
+    Returns:
+        tuple: (record type names, state names) without their enum prefixes
+    """
+    types = benchmark.readEnum(benchmark.readHeader("trace.h"), "trace_type_t")
+    states = benchmark.readEnum(benchmark.readHeader("main.h"), "board_state_t")
+    types = [name[len("trace_type_"):] for name in types if name != "trace_type_count"]
+    states = [name[len("board_state_"):] for name in states if name != "board_state_count"]
+    return types, states
+
+
+def splitRecords(data, numTypes):
+    """Cut the records out of a stream of trace bytes, skipping anything that does not frame as one
+
+    Args:
+        data (bytes): trace bytes, possibly starting or ending mid record
+        numTypes (int): number of record types, to reject false syncs
+
+    Returns:
+        tuple: (list of (type, argument, msec stamp), bytes skipped, bytes left over for the next call)
+    """
+    records = []
+    skipped = 0
+    pos = 0
+    while len(data) - pos >= RECORD_LEN:
+        if data[pos] != SYNC or data[pos + 1] >= numTypes:
+            pos += 1
+            skipped += 1
+            continue
+        records.append((data[pos + 1], data[pos + 2], data[pos + 3] | (data[pos + 4] << 8)))
+        pos += RECORD_LEN
+    return records, skipped, data[pos:]
+
+
+def describe(kind, arg, states):
+    """Put one record into words
+
+    Args:
+        kind (string): record type name
+        arg (int): the argument byte
+        states (list): board state names
+
+    Returns:
+        string: what happened
+    """
+    if kind == "reset":
+        return "reset, " + (", ".join(name for bit, name in RESET_FLAGS if arg & bit) or "no flags")
+    if kind == "state":
+        def stateName(index):
+            return states[index] if index < len(states) else str(index)
+        return "state {} -> {}".format(stateName(arg >> 4), stateName(arg & 0x0F))
+    if kind == "pir":
+        return "PIR " + ("high" if arg else "low")
+    if kind == "wire":
+        # cut_wire_pos_array in main.c puts wire 0 on PA4 up to wire 3 on PA7
+        return "cut wires " + (", ".join(str(wire) for wire in range(4) if arg & (0x10 << wire)) or "none")
+    if kind == "i2c_error":
+        return "I2C " + I2C_STATUS.get(arg, "status {}".format(arg))
+    if kind == "dropped":
+        return "{}{} records dropped, the trace ring was full".format(arg, "+" if arg == 0xFF else "")
+    return "{} {}".format(kind, arg)
+
+
+class Timeline:
+    """Unwraps the 16 bit msec stamps and prints the records as lines of a timeline"""
+
+    def __init__(self, types, states, out):
+        self.types = types
+        self.states = states
+        self.out = out
+        self.lastStamp = None
+        self.ms = 0
+
+    def add(self, kindIndex, arg, stamp):
+        """Print one record
+
+        Args:
+            kindIndex (int): trace_type_t value
+            arg (int): the argument byte
+            stamp (int): the low 16 bits of the msec count
+
+        Returns:
+            None
+        """
+        kind = self.types[kindIndex]
+        if kind == "reset":
+            self.ms = stamp
+        elif self.lastStamp is not None:
+            # the stamps wrap every 65.5 seconds awake, longer gaps between records cannot be told apart
+            self.ms += (stamp - self.lastStamp) & 0xFFFF
+        self.lastStamp = stamp
+        self.out.write("{:>12.3f}  {}\n".format(self.ms / 1000, describe(kind, arg, self.states)))
+
+
+# Now just run the script with reasonable defaults if this script
+#   is invoked directly
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Decode the annoyatron's binary trace into a timeline")
+    parser.add_argument("--port", help="serial port to listen on, until Ctrl-C")
+    parser.add_argument("--baud", type=int, default=benchmark.readDefines(benchmark.readHeader("trace.h"), ("TRACE_BAUD",))["TRACE_BAUD"],
+                        help="trace baud rate, TRACE_BAUD by default")
+    parser.add_argument("--capture", help="also save the raw trace from --port to this file")
+    parser.add_argument("--load", help="decode a raw trace saved earlier instead of listening")
+    args = parser.parse_args()
+
+    if not args.port and not args.load:
+        parser.error("give --port to listen or --load to decode a capture")
+
+    types, states = traceNames()
+    timeline = Timeline(types, states, sys.stdout)
+    skipped = 0
+
+    if args.load:
+        with open(args.load, "rb") as f:
+            records, skipped, _ = splitRecords(f.read(), len(types))
+        for record in records:
+            timeline.add(*record)
+    else:
+        import serial  # pyserial, installed along with pymcuprog
+
+        capture = open(args.capture, "wb") if args.capture else None
+        pending = b""
+        try:
+            with serial.Serial(args.port, args.baud, timeout=0.1) as port:
+                while True:
+                    chunk = port.read(256)
+                    if capture:
+                        capture.write(chunk)
+                    records, lost, pending = splitRecords(pending + chunk, len(types))
+                    skipped += lost
+                    for record in records:
+                        timeline.add(*record)
+                    sys.stdout.flush()
+        except KeyboardInterrupt:
+            pass
+        finally:
+            if capture:
+                capture.close()
+
+    if skipped:
+        print("skipped {} bytes that did not frame as records".format(skipped))